@@ -20,6 +20,9 @@ typedef uint16_t       uint16;
 typedef int32_t        sint32;
 typedef uint32_t       uint32;
 
+typedef int64_t        sint64;
+typedef uint64_t       uint64;
+
 typedef uint_least8_t  uint8_least;
 typedef uint_least16_t uint16_least;
 typedef uint_least32_t uint32_least;
@@ -40,26 +40,44 @@
 Os_ErrorType                    Os_Error;
 Os_TaskControlType              Os_TaskControls        [OS_TASK_COUNT]; /**< control array for tasks */
 Os_ReadyListType                Os_TaskReady           [OS_PRIO_COUNT]; /**< array of ready lists based on priority */
+Os_ReadyMaskType                Os_TaskReadyMask       [OS_READYMASK_COUNT]; /**< bitmap of non empty ready lists */
+Os_ReadyMaskType                Os_TaskReadyGroup;                      /**< bitmap of non empty words in Os_TaskReadyMask */
+volatile Os_PriorityType        Os_TaskReadyHighest;                    /**< highest priority with a non empty ready list, -1 if none */
 Os_TaskType                     Os_ActiveTask;                         /**< currently running task */
 Os_ContextType                  Os_CallContext;                         /**< current call context */
+uint8                           Os_IsrNesting;                          /**< number of interrupts entered and not yet left */
 const Os_TaskConfigType *       Os_TaskConfigs;                         /**< config array for tasks */
 
 const Os_ResourceConfigType *   Os_ResourceConfigs;                     /**< config array for resources */
 Os_ResourceControlType          Os_ResourceControls    [OS_RES_COUNT];  /**< control array for resources */
 
 volatile boolean                Os_Continue;                            /**< should starting task continue */
+boolean                         Os_DispatchPending;                     /**< a task switch is needed at syscall or isr exit */
 
 
 #ifdef OS_ALARM_COUNT
-Os_TickType                     Os_AlarmTicks          [OS_ALARM_COUNT]; /**< ticks for alarms */
-Os_TickType                     Os_AlarmCycles         [OS_ALARM_COUNT]; /**< @brief number of ticks in each cycle */
-boolean                         Os_AlarmQueued         [OS_ALARM_COUNT]; /**< @brief is this alarm active */
+Os_AlarmControlType             Os_AlarmControls       [OS_ALARM_QUEUE_COUNT]; /**< control array for alarms, schedule table alarms last */
 
 const Os_AlarmConfigType *      Os_AlarmConfigs;                         /**< config array for alarms  */
 #endif
 
 #ifdef OS_COUNTER_COUNT
 Os_CounterControlType           Os_CounterControls     [OS_COUNTER_COUNT]; /**< control array for counters */
+Os_AlarmQueueEntryType          Os_AlarmQueuePool      [OS_ALARM_QUEUE_COUNT]; /**< alarm queue storage, one slice per counter */
+const Os_CounterConfigType *    Os_CounterConfigs;                         /**< config array for counters, NULL for defaults */
+#endif
+
+#ifdef OS_ISR_COUNT
+const Os_IsrConfigType *            Os_IsrConfigs;                                    /**< config array for category 2 interrupts */
+#endif
+
+#ifdef OS_TASKGROUP_COUNT
+const Os_TaskGroupConfigType *      Os_TaskGroupConfigs;                              /**< config array for task groups */
+#endif
+
+#ifdef OS_SCHEDULETABLE_COUNT
+Os_ScheduleTableControlType         Os_ScheduleTableControls[OS_SCHEDULETABLE_COUNT]; /**< control array for schedule tables */
+const Os_ScheduleTableConfigType *  Os_ScheduleTableConfigs;                          /**< config array for schedule tables */
 #endif
 
 static Os_StatusType Os_Schedule_Internal(void);
@@ -69,31 +87,129 @@ static Os_StatusType Os_ActivateTask_Internal(Os_TaskType task);
 static Os_StatusType Os_GetResource_Internal(Os_ResourceType res);
 static Os_StatusType Os_ReleaseResource_Internal(Os_ResourceType res);
 static Os_StatusType Os_IncrementCounter_Internal(Os_CounterType counter);
+static Os_StatusType Os_AdvanceCounter_Internal(Os_CounterType counter, Os_TickType ticks);
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC1) ||  (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) )
+static Os_StatusType Os_SetEvent_Internal(Os_TaskType task, Os_EventMaskType mask);
+#endif
+
+static void Os_AlarmAdvance(Os_CounterType counter, Os_TickType ticks);
+static void Os_AlarmAdd    (Os_AlarmType alarm);
+
+#if defined(__GNUC__) && (__SIZEOF_INT__ == 4)
+#define Os_ReadyMaskClz(mask) (uint8)__builtin_clz(mask)
+#elif defined(__GNUC__) && (__SIZEOF_LONG__ == 4)
+#define Os_ReadyMaskClz(mask) (uint8)__builtin_clzl(mask)
+#else
+/**
+ * @brief Count leading zeros of a non zero ready mask word
+ *
+ * Portable fallback for compilers without a builtin, such as chc12.
+ */
+static uint8 Os_ReadyMaskClz(Os_ReadyMaskType mask)
+{
+    static const uint8 nibble[16] = { 4u, 3u, 2u, 2u, 1u, 1u, 1u, 1u
+                                    , 0u, 0u, 0u, 0u, 0u, 0u, 0u, 0u };
+    uint8 res = 0u;
+    if ((mask & 0xffff0000ul) == 0u) {
+        res  += 16u;
+        mask <<= 16u;
+    }
+    if ((mask & 0xff000000ul) == 0u) {
+        res  += 8u;
+        mask <<= 8u;
+    }
+    if ((mask & 0xf0000000ul) == 0u) {
+        res  += 4u;
+        mask <<= 4u;
+    }
+    return res + nibble[mask >> 28u];
+}
+#endif
+
+/** compile time check that the ready bitmap can hold all priorities */
+typedef char Os_ReadyMaskCheck[(OS_READYMASK_COUNT <= OS_READYMASK_BITS) ? 1 : -1];
+
+/** compile time checks that identifiers fit next to the reserved invalid value */
+typedef char Os_TaskCountCheck    [(OS_TASK_COUNT  < OS_INVALID_TASK    ) ? 1 : -1];
+typedef char Os_ResourceCountCheck[(OS_RES_COUNT   < OS_INVALID_RESOURCE) ? 1 : -1];
+#ifdef OS_ALARM_COUNT
+typedef char Os_AlarmCountCheck   [(OS_ALARM_QUEUE_COUNT < OS_INVALID_ALARM) ? 1 : -1];
+#endif
+#ifdef OS_SCHEDULETABLE_COUNT
+typedef char Os_ScheduleTableCountCheck[(OS_SCHEDULETABLE_COUNT < OS_INVALID_SCHEDULETABLE) ? 1 : -1];
+#endif
+typedef char Os_AlarmHeapCheck    [(OS_ALARM_HEAP_ARITY >= 2u) ? 1 : -1];
+#if(OS_SYSCALL_DIRECT_ENABLE)
+/** compile time check that tick arguments survive the register sized direct syscall abi */
+typedef char Os_SyscallTickCheck  [(sizeof(Os_TickType) <= sizeof(Os_SyscallArgType)) ? 1 : -1];
+#endif
+#if(OS_ALARM_WHEEL_ENABLE)
+typedef char Os_AlarmWheelCheck   [(OS_ALARM_WHEEL_LEVELS * OS_ALARM_WHEEL_SLOTS <= (Os_AlarmQueueIndexType)-1 + 1u) ? 1 : -1];
+#endif
+
+/**
+ * @brief Get the index of the highest set bit of a non empty ready mask word
+ */
+#define Os_ReadyMaskHighest(mask) (uint16)((OS_READYMASK_BITS - 1u) - Os_ReadyMaskClz(mask))
+
+/**
+ * @brief Mark the ready list of given priority as non empty
+ */
+static __inline void Os_ReadyMaskSet(Os_PriorityType prio)
+{
+    uint16 index = (uint16)prio / OS_READYMASK_BITS;
+    Os_TaskReadyMask[index] |= (Os_ReadyMaskType)1u << ((uint16)prio % OS_READYMASK_BITS);
+    Os_TaskReadyGroup       |= (Os_ReadyMaskType)1u << index;
+    if (prio > Os_TaskReadyHighest) {
+        Os_TaskReadyHighest = prio;
+    }
+}
+
+/**
+ * @brief Mark the ready list of given priority as empty
+ */
+static __inline void Os_ReadyMaskClear(Os_PriorityType prio)
+{
+    uint16 index = (uint16)prio / OS_READYMASK_BITS;
+    Os_TaskReadyMask[index] &= ~((Os_ReadyMaskType)1u << ((uint16)prio % OS_READYMASK_BITS));
+    if (Os_TaskReadyMask[index] == 0u) {
+        Os_TaskReadyGroup   &= ~((Os_ReadyMaskType)1u << index);
+    }
 
-static void Os_AlarmTick   (Os_AlarmType queue[]);
-static void Os_AlarmAdd    (Os_AlarmType queue[], Os_AlarmType alarm);
+    if (prio == Os_TaskReadyHighest) {
+        if (Os_TaskReadyGroup) {
+            index = Os_ReadyMaskHighest(Os_TaskReadyGroup);
+            Os_TaskReadyHighest = (Os_PriorityType)(index * OS_READYMASK_BITS + Os_ReadyMaskHighest(Os_TaskReadyMask[index]));
+        } else {
+            Os_TaskReadyHighest = -1;
+        }
+    }
+}
 
 /**
  * @brief Add task to the given ready list at the head of the list
- * @param[in] list ready list to add task to
+ * @param[in] prio priority of ready list to add task to
  * @param[in] task task to add to list
  */
-static void Os_ReadyListPushHead(Os_ReadyListType* list, Os_TaskType task)
+static void Os_ReadyListPushHead(Os_PriorityType prio, Os_TaskType task)
 {
+    Os_ReadyListType* list = &Os_TaskReady[prio];
     Os_TaskControls[task].next = list->head;
     list->head = task;
     if (list->tail == OS_INVALID_TASK) {
         list->tail = task;
+        Os_ReadyMaskSet(prio);
     }
 }
 
 /**
  * @brief Pop task from the head of the ready list
- * @param[in]  list ready list to add task to
+ * @param[in]  prio priority of ready list to pop task from
  * @param[out] task popped from list, Os_TaskIdNone if nothing available.
  */
-static void Os_ReadyListPopHead(Os_ReadyListType* list, Os_TaskType* task)
+static void Os_ReadyListPopHead(Os_PriorityType prio, Os_TaskType* task)
 {
+    Os_ReadyListType* list = &Os_TaskReady[prio];
     if (list->tail == OS_INVALID_TASK) {
         *task = OS_INVALID_TASK;
     } else {
@@ -101,22 +217,25 @@ static void Os_ReadyListPopHead(Os_ReadyListType* list, Os_TaskType* task)
         if (list->tail == *task) {
             list->tail = OS_INVALID_TASK;
             list->head = OS_INVALID_TASK;
+            Os_ReadyMaskClear(prio);
         }
         list->head = Os_TaskControls[*task].next;
+        Os_TaskControls[*task].next = OS_INVALID_TASK;
     }
-    Os_TaskControls[*task].next = OS_INVALID_TASK;
 }
 
 /**
  * @brief Add task to given ready list at the tail of the list
- * @param[in] list ready list to add task to
+ * @param[in] prio priority of ready list to add task to
  * @param[in] task task to add to list
  */
-static void Os_ReadyListPushTail(Os_ReadyListType* list, Os_TaskType task)
+static void Os_ReadyListPushTail(Os_PriorityType prio, Os_TaskType task)
 {
+    Os_ReadyListType* list = &Os_TaskReady[prio];
     Os_TaskControls[task].next = OS_INVALID_TASK;
     if (list->head == OS_INVALID_TASK) {
         list->head = task;
+        Os_ReadyMaskSet(prio);
     } else {
         Os_TaskControls[list->tail].next = task;
     }
@@ -143,96 +262,462 @@ static __inline boolean Os_TickLessThan(Os_TickType lh, Os_TickType rh)
 }
 
 /**
- * @brief Restore heap order by bubbling element down children until it's larger
+ * @brief Get the heap slot of the parent of given non root slot
+ */
+#define Os_AlarmHeapParent(index) (Os_AlarmQueueIndexType)(((index) - 1u) / OS_ALARM_HEAP_ARITY)
+
+/**
+ * @brief Store entry in given heap slot, keeping the back index in sync
  */
-void Os_AlarmHeapify(Os_AlarmType queue[]
-                   , Os_AlarmQueueIndexType index)
+static __inline void Os_AlarmPlace(Os_AlarmQueueEntryType queue[], Os_AlarmQueueIndexType index, Os_AlarmQueueEntryType entry)
 {
-    Os_AlarmQueueIndexType child;
-    Os_AlarmType           swap;
+    queue[index]                        = entry;
+    Os_AlarmControls[entry.alarm].index = index;
+}
 
-    while (1u) {
-        child = index * 2u;
-        if ((child <= queue[0u]) && Os_TickLessThan(Os_AlarmTicks[queue[child]], Os_AlarmTicks[queue[index]]) ) {
-            goto OS_ALARMHEAPIFY_SWAP;
+/**
+ * @brief Restore heap order by bubbling entry down from a hole at index until it's smaller than all children
+ */
+void Os_AlarmHeapify(Os_CounterControlType* control
+                   , Os_AlarmQueueIndexType index
+                   , Os_AlarmQueueEntryType entry)
+{
+    Os_AlarmQueueEntryType* queue = control->queue;
+    uint32                  count = control->count;
+    uint32                  child;
+    uint32                  last;
+    uint32                  best;
+
+    for (best = (uint32)index * OS_ALARM_HEAP_ARITY + 1u; best < count; best = (uint32)index * OS_ALARM_HEAP_ARITY + 1u) {
+        /* pick the earliest of the children */
+        last  = best + OS_ALARM_HEAP_ARITY;
+        if (last > count) {
+            last = count;
+        }
+        for (child = best + 1u; child < last; ++child) {
+            if (!Os_TickLessThan(queue[best].tick, queue[child].tick)) {
+                best = child;
+            }
         }
 
-        child++;
-        if ((child <= queue[0u]) && Os_TickLessThan(Os_AlarmTicks[queue[child]], Os_AlarmTicks[queue[index]]) ) {
-            goto OS_ALARMHEAPIFY_SWAP;
+        if (Os_TickLessThan(entry.tick, queue[best].tick)) {
+            break;
         }
-        break;
 
-OS_ALARMHEAPIFY_SWAP:
-        swap = queue[index];
-        queue[index] = queue[child];
-        queue[child] = swap;
-        index        = child;
+        Os_AlarmPlace(queue, index, queue[best]);
+        index = (Os_AlarmQueueIndexType)best;
+    }
+    Os_AlarmPlace(queue, index, entry);
+}
+
+/**
+ * @brief Restore heap order by bubbling entry up from a hole at index until it's larger than its parent
+ *
+ * The entry is passed by value rather than read back from the hole, it
+ * is usually just built by the caller.
+ */
+static void Os_AlarmSiftUp(Os_CounterControlType* control
+                         , Os_AlarmQueueIndexType index
+                         , Os_AlarmQueueEntryType entry)
+{
+    Os_AlarmQueueEntryType* queue = control->queue;
+    Os_AlarmQueueIndexType  parent;
+
+    while (index > 0u) {
+        parent = Os_AlarmHeapParent(index);
+        if (!Os_TickLessThan(entry.tick, queue[parent].tick)) {
+            break;
+        }
+        Os_AlarmPlace(queue, index, queue[parent]);
+        index = parent;
     }
+    Os_AlarmPlace(queue, index, entry);
 }
 
 /**
  * @brief Pop the first alarm out of the queue
- * @param queue the queue to look through
- * @param alarm the resulting alarm
+ * @param control the counter whose queue to look through
+ * @param alarm   the resulting alarm
+ */
+static void Os_AlarmPop(Os_CounterControlType* control, Os_AlarmType* alarm)
+{
+    *alarm = control->queue[0u].alarm;
+
+    control->count--;
+    if (control->count > 0u) {
+        Os_AlarmHeapify(control, 0u, control->queue[control->count]);
+    }
+    Os_AlarmControls[*alarm].queued = FALSE;
+}
+
+/**
+ * @brief Counter driving given alarm, including the alarms of schedule tables
+ */
+static __inline Os_CounterType Os_AlarmCounter(Os_AlarmType alarm)
+{
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC1) ||  (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) )
+    if (alarm >= OS_ALARM_TIMEOUT_FIRST) {
+        return OS_COUNTER_SYSTEM;
+    }
+#endif
+#ifdef OS_SCHEDULETABLE_COUNT
+    if (alarm >= OS_ALARM_COUNT) {
+        return Os_ScheduleTableConfigs[alarm - OS_ALARM_COUNT].counter;
+    }
+#endif
+    return Os_AlarmConfigs[alarm].counter;
+}
+
+#ifdef OS_SCHEDULETABLE_COUNT
+static void Os_ScheduleTableExpire(Os_ScheduleTableType table);
+#endif
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC1) ||  (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) )
+static void Os_EventTimeout(Os_TaskType task);
+#endif
+
+/**
+ * @brief Perform the action of an expired alarm
+ */
+static void Os_AlarmExpire(Os_AlarmType alarm)
+{
+    Os_ContextType context;
+
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC1) ||  (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) )
+    if (alarm >= OS_ALARM_TIMEOUT_FIRST) {
+        Os_EventTimeout((Os_TaskType)(alarm - OS_ALARM_TIMEOUT_FIRST));
+        return;
+    }
+#endif
+#ifdef OS_SCHEDULETABLE_COUNT
+    if (alarm >= OS_ALARM_COUNT) {
+        Os_ScheduleTableExpire((Os_ScheduleTableType)(alarm - OS_ALARM_COUNT));
+        return;
+    }
+#endif
+
+    if (Os_AlarmConfigs[alarm].action == OS_ALARM_ACTION_ALARMCALLBACK) {
+        /* runs on whatever stack advanced the counter, services are refused meanwhile */
+        context        = Os_CallContext;
+        Os_CallContext = OS_CONTEXT_ALARMCALLBACK;
+        Os_AlarmConfigs[alarm].callback();
+        Os_CallContext = context;
+        return;
+    }
+
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC1) ||  (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) )
+    if (Os_AlarmConfigs[alarm].action == OS_ALARM_ACTION_SETEVENT) {
+        (void)Os_SetEvent_Internal(Os_AlarmConfigs[alarm].task, Os_AlarmConfigs[alarm].event);
+        return;
+    }
+#endif
+
+    /* activate linked task */
+    if (Os_AlarmConfigs[alarm].task != OS_INVALID_TASK) {
+        (void)Os_ActivateTask_Internal(Os_AlarmConfigs[alarm].task);
+    }
+}
+
+/**
+ * @brief Queue alarm on the heap
+ */
+static void Os_AlarmHeapAdd(Os_CounterControlType* control, Os_AlarmType alarm)
+{
+    Os_AlarmQueueEntryType entry;
+    entry.tick  = Os_AlarmControls[alarm].ticks;
+    entry.alarm = alarm;
+    control->count++;
+    Os_AlarmSiftUp(control, (Os_AlarmQueueIndexType)(control->count - 1u), entry);
+    Os_AlarmControls[alarm].queued = TRUE;
+}
+
+/**
+ * @brief Restore heap order after entries were appended unordered from slot first on
+ *
+ * A few appended entries are sifted up one by one in O(k log n). When they
+ * outnumber the entries already in order, the whole heap is rebuilt bottom
+ * up instead, which is O(n).
  */
-static void Os_AlarmPop(Os_AlarmType queue[], Os_AlarmType* alarm)
+static void Os_AlarmHeapMerge(Os_CounterControlType* control, Os_AlarmQueueIndexType first)
 {
-    *alarm      = queue[1u];
+    Os_AlarmQueueIndexType index;
 
-    if (queue[0u] > 1u) {
-        queue[1u] = queue[queue[0u]];
-        queue[0u]--;
-        Os_AlarmHeapify(queue, 1u);
+    if ((Os_AlarmQueueIndexType)(control->count - first) > first) {
+        for (index = (Os_AlarmQueueIndexType)(Os_AlarmHeapParent(control->count - 1u) + 1u); index > 0u; --index) {
+            Os_AlarmHeapify(control, (Os_AlarmQueueIndexType)(index - 1u), control->queue[index - 1u]);
+        }
     } else {
-        queue[0u] = 0u;
+        for (index = first; index < control->count; ++index) {
+            Os_AlarmSiftUp(control, index, control->queue[index]);
+        }
     }
-    Os_AlarmQueued[*alarm] = FALSE;
 }
 
 /**
- * @brief Ticks the given alarm chain
- * @param[in,out] head start of chain to tick, will be updated to current head
+ * @brief Ticks the alarm heap of given counter
+ * @param[in] counter counter that was just incremented
  */
-void Os_AlarmTick(Os_AlarmType queue[])
+static void Os_AlarmHeapTick(Os_CounterType counter)
 {
+    Os_CounterControlType* control = &Os_CounterControls[counter];
+
     /* trigger and consume any expired */
-    while (queue[0] > 0u && Os_TickLessThan(Os_AlarmTicks[queue[1]], Os_CounterControls[Os_AlarmConfigs[queue[1]].counter].ticks) ) {
+    while (control->count > 0u && Os_TickLessThan(control->queue[0u].tick, control->ticks) ) {
         Os_AlarmType alarm;
-        Os_AlarmPop(queue, &alarm);
+        Os_AlarmPop(control, &alarm);
+        Os_AlarmExpire(alarm);
+
+        /* readd cyclic */
+        if (Os_AlarmControls[alarm].cycle) {
+            Os_AlarmControls[alarm].ticks += Os_AlarmControls[alarm].cycle;
+            Os_AlarmHeapAdd(control, alarm);
+        }
+    }
+}
+
+/**
+ * @brief Remove a queued alarm from the heap
+ */
+static void Os_AlarmHeapRemove(Os_CounterControlType* control, Os_AlarmType alarm)
+{
+    Os_AlarmQueueEntryType* queue = control->queue;
+    Os_AlarmQueueIndexType  index = Os_AlarmControls[alarm].index;
+    Os_AlarmQueueEntryType  entry;
+
+    /* if this is not the last item, move the last one in and restore order either way */
+    control->count--;
+    if (control->count != index) {
+        entry = queue[control->count];
+        if ((index > 0u) && Os_TickLessThan(entry.tick, queue[Os_AlarmHeapParent(index)].tick)) {
+            Os_AlarmSiftUp(control, index, entry);
+        } else {
+            Os_AlarmHeapify(control, index, entry);
+        }
+    }
+}
+
+#if(OS_ALARM_WHEEL_ENABLE)
+
+/**
+ * @brief Check if given counter queues its alarms on the timing wheel
+ */
+static __inline boolean Os_AlarmWheelUsed(Os_CounterType counter)
+{
+    return (Os_CounterConfigs != NULL) && (Os_CounterConfigs[counter].queue == OS_COUNTER_QUEUE_WHEEL);
+}
+
+/**
+ * @brief Link alarm into the wheel slot matching given expiry tick
+ *
+ * The level is picked from the most significant digit in which expiry and
+ * current counter value differ. The slot is revisited when the counter
+ * reaches that digit value, at which point the alarm moves down a level.
+ */
+static void Os_AlarmWheelLink(Os_CounterControlType* control, Os_AlarmType alarm, Os_TickType expiry)
+{
+    Os_TickType            diff  = (Os_TickType)(expiry ^ control->ticks);
+    Os_AlarmQueueIndexType index = 0u;
+
+    while (diff >= OS_ALARM_WHEEL_SLOTS) {
+        diff   >>= OS_ALARM_WHEEL_BITS;
+        expiry >>= OS_ALARM_WHEEL_BITS;
+        index   += OS_ALARM_WHEEL_SLOTS;
+    }
+    index += (Os_AlarmQueueIndexType)(expiry & (OS_ALARM_WHEEL_SLOTS - 1u));
+
+    Os_AlarmControls[alarm].index = index;
+    Os_AlarmControls[alarm].prev = OS_INVALID_ALARM;
+    Os_AlarmControls[alarm].next = control->wheel[index];
+    if (control->wheel[index] != OS_INVALID_ALARM) {
+        Os_AlarmControls[control->wheel[index]].prev = alarm;
+    }
+    control->wheel[index] = alarm;
+}
+
+/**
+ * @brief Unlink alarm from its wheel slot
+ */
+static void Os_AlarmWheelRemove(Os_CounterControlType* control, Os_AlarmType alarm)
+{
+    Os_AlarmType next = Os_AlarmControls[alarm].next;
+    Os_AlarmType prev = Os_AlarmControls[alarm].prev;
+
+    if (prev == OS_INVALID_ALARM) {
+        control->wheel[Os_AlarmControls[alarm].index] = next;
+    } else {
+        Os_AlarmControls[prev].next = next;
+    }
+    if (next != OS_INVALID_ALARM) {
+        Os_AlarmControls[next].prev = prev;
+    }
+}
+
+/**
+ * @brief Queue alarm on the timing wheel
+ * @param[in] control control of the counter driving the alarm
+ * @param[in] alarm   alarm to queue
+ * @param[in] base    first tick the alarm can expire at
+ *
+ * Alarms with a tick at or before base expire at base, which gives the
+ * same expiry ticks as the heap with its Os_TickLessThan ordering.
+ */
+static void Os_AlarmWheelAdd(Os_CounterControlType* control, Os_AlarmType alarm, Os_TickType base)
+{
+    if (Os_TickLessThan(Os_AlarmControls[alarm].ticks, base)) {
+        Os_AlarmWheelLink(control, alarm, base);
+    } else {
+        Os_AlarmWheelLink(control, alarm, Os_AlarmControls[alarm].ticks);
+    }
+    Os_AlarmControls[alarm].queued = TRUE;
+}
+
+/**
+ * @brief Ticks the timing wheel of given counter
+ * @param[in] counter counter that was just incremented
+ *
+ * Levels whose digit just changed are emptied into the levels below,
+ * then every alarm in the level zero slot of the current tick expires.
+ */
+static void Os_AlarmWheelTick(Os_CounterType counter)
+{
+    Os_CounterControlType* control = &Os_CounterControls[counter];
+    Os_TickType            now     = control->ticks;
+    Os_AlarmQueueIndexType level   = 0u;
+    Os_AlarmQueueIndexType index;
+    Os_AlarmType           alarm;
+    Os_AlarmType           next;
+
+    /* a level is entered when all digits below it wrapped to zero */
+    while ((level + 1u < OS_ALARM_WHEEL_LEVELS)
+        && (((now >> (level * OS_ALARM_WHEEL_BITS)) & (OS_ALARM_WHEEL_SLOTS - 1u)) == 0u)) {
+        level++;
+    }
 
-        /* activate linked task */
-        if (Os_AlarmConfigs[alarm].task != OS_INVALID_TASK) {
-            (void)Os_ActivateTask_Internal(Os_AlarmConfigs[alarm].task);
+    for (; level > 0u; --level) {
+        index = (Os_AlarmQueueIndexType)(level * OS_ALARM_WHEEL_SLOTS
+                                      + ((now >> (level * OS_ALARM_WHEEL_BITS)) & (OS_ALARM_WHEEL_SLOTS - 1u)));
+        alarm = control->wheel[index];
+        control->wheel[index] = OS_INVALID_ALARM;
+        while (alarm != OS_INVALID_ALARM) {
+            next = Os_AlarmControls[alarm].next;
+            Os_AlarmWheelAdd(control, alarm, now);
+            alarm = next;
         }
+    }
 
-        /* trigger any event - TODO */
+    /* trigger and consume any expired, cyclic alarms already due are readded to the same slot */
+    index = (Os_AlarmQueueIndexType)(now & (OS_ALARM_WHEEL_SLOTS - 1u));
+    while (control->wheel[index] != OS_INVALID_ALARM) {
+        alarm = control->wheel[index];
+        Os_AlarmWheelRemove(control, alarm);
+        Os_AlarmControls[alarm].queued = FALSE;
+        Os_AlarmExpire(alarm);
 
         /* readd cyclic */
-        if (Os_AlarmCycles[alarm]) {
-            Os_AlarmTicks[alarm] += Os_AlarmCycles[alarm];
-            Os_AlarmAdd(queue, alarm);
+        if (Os_AlarmControls[alarm].cycle) {
+            Os_AlarmControls[alarm].ticks += Os_AlarmControls[alarm].cycle;
+            Os_AlarmWheelAdd(control, alarm, now);
+        }
+    }
+}
+
+#endif /* OS_ALARM_WHEEL_ENABLE */
+
+/**
+ * @brief Advance given counter and expire the alarms of its heap
+ * @param[in] counter counter to advance
+ * @param[in] ticks   number of ticks to advance
+ *
+ * The counter jumps straight to the expiry of the earliest alarm, so the
+ * cost depends on the number of expiries rather than the number of ticks.
+ * Alarms see the counter at their own expiry tick, and cyclic alarms that
+ * come due again inside the window expire again in order.
+ */
+static void Os_AlarmHeapAdvance(Os_CounterType counter, Os_TickType ticks)
+{
+    Os_CounterControlType* control = &Os_CounterControls[counter];
+    Os_TickType            step;
+
+    while (ticks > 0u) {
+        step = ticks;
+        if (control->count > 0u) {
+            if (Os_TickLessThan(control->queue[0u].tick, (Os_TickType)(control->ticks + 1u))) {
+                /* already due, expires on the very next tick */
+                step = 1u;
+            } else if ((Os_TickType)(control->queue[0u].tick - control->ticks) < step) {
+                step = (Os_TickType)(control->queue[0u].tick - control->ticks);
+            }
         }
+        control->ticks += step;
+        ticks          -= step;
+        Os_AlarmHeapTick(counter);
+    }
+}
+
+#if(OS_ALARM_WHEEL_ENABLE)
+/**
+ * @brief Advance given counter and expire the alarms of its timing wheel
+ * @param[in] counter counter to advance
+ * @param[in] ticks   number of ticks to advance
+ *
+ * Every tick is visited to keep the levels cascading, which is cheap for
+ * ticks with empty slots.
+ */
+static void Os_AlarmWheelAdvance(Os_CounterType counter, Os_TickType ticks)
+{
+    for (; ticks > 0u; --ticks) {
+        Os_CounterControls[counter].ticks++;
+        Os_AlarmWheelTick(counter);
     }
 }
+#endif
 
-void Os_AlarmAdd(Os_AlarmType queue[], Os_AlarmType alarm)
+/**
+ * @brief Advance given counter and expire any alarms that come due
+ * @param[in] counter counter to advance
+ * @param[in] ticks   number of ticks to advance
+ */
+static void Os_AlarmAdvance(Os_CounterType counter, Os_TickType ticks)
 {
-    Os_AlarmType index
-               , parent;
+#if(OS_ALARM_WHEEL_ENABLE)
+    if (Os_AlarmWheelUsed(counter)) {
+        Os_AlarmWheelAdvance(counter, ticks);
+        return;
+    }
+#endif
+    Os_AlarmHeapAdvance(counter, ticks);
+}
 
-    queue[0]++;
+/**
+ * @brief Queue alarm on the queue of its counter, Os_AlarmTicks must be set up
+ */
+static void Os_AlarmAdd(Os_AlarmType alarm)
+{
+    Os_CounterType counter = Os_AlarmCounter(alarm);
+#if(OS_ALARM_WHEEL_ENABLE)
+    if (Os_AlarmWheelUsed(counter)) {
+        /* the counter is checked first after its next increment */
+        Os_AlarmWheelAdd(&Os_CounterControls[counter], alarm, (Os_TickType)(Os_CounterControls[counter].ticks + 1u));
+        return;
+    }
+#endif
+    Os_AlarmHeapAdd(&Os_CounterControls[counter], alarm);
+}
 
-    index  = queue[0u];
-    parent = queue[0u] / 2u;
-    while (index > 1u && Os_TickLessThan(Os_AlarmTicks[alarm]
-                                       , Os_AlarmTicks[queue[parent]]) ) {
-        queue[index] = queue[parent];
-        index   = parent;
-        parent /= 2u;
+/**
+ * @brief Remove a queued alarm from the queue of its counter
+ */
+static void Os_AlarmRemove(Os_AlarmType alarm)
+{
+    Os_CounterType counter = Os_AlarmCounter(alarm);
+#if(OS_ALARM_WHEEL_ENABLE)
+    if (Os_AlarmWheelUsed(counter)) {
+        Os_AlarmWheelRemove(&Os_CounterControls[counter], alarm);
+    } else
+#endif
+    {
+        Os_AlarmHeapRemove(&Os_CounterControls[counter], alarm);
     }
-    queue[index] = alarm;
-    Os_AlarmQueued[alarm] = TRUE;
+    Os_AlarmControls[alarm].queued = FALSE;
 }
 
 /**
@@ -254,10 +739,12 @@ static void Os_TaskInit(Os_TaskType task)
  */
 static __inline void Os_TaskPeek(Os_PriorityType min_priority, Os_TaskType* task)
 {
-    Os_PriorityType prio;
-    *task = OS_INVALID_TASK;
-    for(prio = OS_PRIO_COUNT - 1; (prio > min_priority) && (*task == OS_INVALID_TASK); --prio) {
+    Os_PriorityType prio = Os_TaskReadyHighest;
+
+    if (prio > min_priority) {
         *task = Os_TaskReady[prio].head;
+    } else {
+        *task = OS_INVALID_TASK;
     }
 }
 
@@ -314,6 +801,21 @@ void Os_TaskInternalResource_Get(void)
     }
 }
 
+/**
+ * @brief Get the priority the running task currently executes at
+ * @return priority of running task, -1 if no task is running
+ */
+static __inline Os_PriorityType Os_RunningPriority(void)
+{
+    Os_PriorityType prio;
+    if ((Os_ActiveTask != OS_INVALID_TASK) && (Os_TaskControls[Os_ActiveTask].state == OS_TASK_RUNNING)) {
+        prio = Os_TaskControls[Os_ActiveTask].priority;
+    } else {
+        prio = -1;
+    }
+    return prio;
+}
+
 /**
  * @brief Perform the state transition from running to suspended for a task
  * @param task task to transition to suspended state
@@ -343,18 +845,58 @@ static __inline void Os_State_Running_To_Ready(Os_TaskType task)
 
     prio = Os_TaskControls[task].priority;
 
-    Os_ReadyListPushHead(&Os_TaskReady[prio], task);
+    Os_ReadyListPushHead(prio, task);
     Os_TaskControls[task].state = OS_TASK_READY;
 
     OS_POSTTASKHOOK(task);
 }
 
+/**
+ * @brief Restart the running task from its entry point
+ * @param task running task to restart
+ *
+ * Shortcut for a task chaining into itself when it would be picked as the
+ * next task anyway. Same hooks, priority and cleared events as going
+ * through suspended and ready, but the ready lists are never touched. The arch restarts the
+ * stack when leaving the kernel, since the state was prepared again.
+ */
+static __inline void Os_State_Running_Restart(Os_TaskType task)
+{
+    OS_CHECK_EXT(Os_TaskControls[task].state == OS_TASK_RUNNING, E_OS_STATE);
+
+    OS_POSTTASKHOOK(task);
+
+    Os_TaskControls[task].priority = Os_TaskConfigs[task].priority;
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC1) ||  (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) )
+    Os_TaskControls[task].events   = 0u;
+#endif
+    Os_Arch_PrepareState(task);
+
+    OS_PRETASKHOOK(task);
+}
+
+/**
+ * @brief Request a dispatch if a newly ready task should preempt the running task
+ * @param prio priority of the task that became ready
+ *
+ * Tasks readied at or below the running priority are only queued, neither
+ * the scheduler nor the arch context switch is involved until the running
+ * task gives up the cpu.
+ */
+static __inline void Os_ReadyPreempt(Os_PriorityType prio)
+{
+    if (prio > Os_RunningPriority()) {
+        Os_DispatchPending = TRUE;
+    }
+}
+
 /**
  * @brief Perform the state transition from suspended to the ready list
  * @param task task to transition to the ready state
  *
  * This will prepare the stack structure for execution of this task's
- * main function and push the task into the tail of the ready list
+ * main function and push the task into the tail of the ready list. A
+ * dispatch is requested if the task should preempt the running task.
  */
 static __inline void Os_State_Suspended_To_Ready(Os_TaskType task)
 {
@@ -365,9 +907,53 @@ static __inline void Os_State_Suspended_To_Ready(Os_TaskType task)
     prio = Os_TaskConfigs[task].priority;
     Os_TaskControls[task].state    = OS_TASK_READY_FIRST;
     Os_TaskControls[task].priority = prio;
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC1) ||  (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) )
+    Os_TaskControls[task].events   = 0u;
+#endif
+
+    Os_ReadyListPushTail(prio, task);
+    Os_ReadyPreempt(prio);
+}
+
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC1) ||  (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) )
+/**
+ * @brief Perform the state transition from running to waiting for a task
+ * @param task task to transition to the waiting state
+ *
+ * The stack of the task is left as is, so it continues where it called
+ * Os_WaitEvent once it runs again.
+ */
+static __inline void Os_State_Running_To_Waiting(Os_TaskType task)
+{
+    OS_CHECK_EXT(Os_TaskControls[task].state == OS_TASK_RUNNING, E_OS_STATE);
+
+    Os_TaskControls[task].state = OS_TASK_WAITING;
+
+    OS_POSTTASKHOOK(task);
+}
+
+/**
+ * @brief Perform the state transition from waiting to the ready list
+ * @param task task to transition to the ready state
+ *
+ * Unlike a task coming from suspended, the state of the task is not
+ * prepared again, it resumes inside Os_WaitEvent. The caller requests the
+ * dispatch, so a batch of woken tasks is checked against the running task
+ * once.
+ */
+static __inline void Os_State_Waiting_To_Ready(Os_TaskType task)
+{
+    Os_PriorityType prio;
+
+    OS_CHECK_EXT(Os_TaskControls[task].state == OS_TASK_WAITING, E_OS_STATE);
+
+    prio = Os_TaskConfigs[task].priority;
+    Os_TaskControls[task].state    = OS_TASK_READY;
+    Os_TaskControls[task].priority = prio;
 
-    Os_ReadyListPushTail(&Os_TaskReady[prio], task);
+    Os_ReadyListPushTail(prio, task);
 }
+#endif
 
 /**
  * @brief Perform the state transition from ready to running
@@ -385,7 +971,7 @@ static __inline void Os_State_Ready_To_Running(Os_TaskType task)
                || Os_TaskControls[task].state == OS_TASK_READY_FIRST, E_OS_STATE);
 
     prio = Os_TaskControls[task].priority;
-    Os_ReadyListPopHead(&Os_TaskReady[prio], &task2);
+    Os_ReadyListPopHead(prio, &task2);
 
     OS_CHECK_EXT(task2 == task, E_OS_STATE);
 
@@ -418,7 +1004,8 @@ Os_StatusType Os_Shutdown_Internal(void)
 {
     Os_TaskType prev;
 
-    Os_Continue = FALSE;
+    Os_Continue        = FALSE;
+    Os_DispatchPending = FALSE;
 
     if (Os_TaskControls[Os_ActiveTask].state == OS_TASK_RUNNING) {
         /* put preempted task as first ready */
@@ -441,19 +1028,13 @@ Os_StatusType Os_Shutdown_Internal(void)
  */
 Os_StatusType Os_Schedule_Internal(void)
 {
-    Os_PriorityType prio;
     Os_TaskType     task;
 
-    if (Os_TaskControls[Os_ActiveTask].state == OS_TASK_RUNNING) {
-        prio = Os_TaskControls[Os_ActiveTask].priority;
-    } else {
-        prio = -1;
-    }
-
-    Os_TaskPeek(prio, &task);
+    Os_DispatchPending = FALSE;
+    Os_TaskPeek(Os_RunningPriority(), &task);
 
     if(task != OS_INVALID_TASK) {
-        if (Os_TaskControls[Os_ActiveTask].state == OS_TASK_RUNNING) {
+        if ((Os_ActiveTask != OS_INVALID_TASK) && (Os_TaskControls[Os_ActiveTask].state == OS_TASK_RUNNING)) {
             /* put preempted task as first ready */
             Os_State_Running_To_Ready(Os_ActiveTask);
         }
@@ -465,12 +1046,108 @@ Os_StatusType Os_Schedule_Internal(void)
     return E_OK;
 }
 
+/**
+ * @brief Perform the task switch requested by services since last dispatch
+ * @return E_OK on success
+ *
+ * Services only flag that the ready set changed above the running
+ * priority, the actual switch is done once on syscall or interrupt exit.
+ * Inside an interrupt the switch is left to the exit of the outermost one,
+ * the interrupted task is still on the stack below the handlers.
+ */
+static __inline Os_StatusType Os_Dispatch(void)
+{
+    Os_StatusType res = E_OK;
+    if (Os_DispatchPending && (Os_IsrNesting == 0u)) {
+        res = Os_Schedule_Internal();
+    }
+    return res;
+}
+
+/**
+ * @brief Bookkeeping on entry of an interrupt that may call services
+ * @return call context of the interrupted code, to be given to Os_IsrExit
+ *
+ * Must be called with interrupts disabled.
+ */
+static __inline Os_ContextType Os_IsrEnter(void)
+{
+    Os_ContextType context = Os_CallContext;
+    Os_IsrNesting++;
+    Os_CallContext = OS_CONTEXT_ISR2;
+    return context;
+}
+
+/**
+ * @brief Bookkeeping on exit of an interrupt, dispatch if it is the outermost
+ * @param[in] context call context returned by the matching Os_IsrEnter
+ *
+ * Must be called with interrupts disabled. The arch switches to the task
+ * selected here when it returns from the interrupt.
+ */
+static __inline void Os_IsrExit(Os_ContextType context)
+{
+    Os_CallContext = context;
+    Os_IsrNesting--;
+    (void)Os_Dispatch();
+}
+
+/**
+ * @brief Interrupt entry advancing given counter by a number of ticks
+ * @param[in] counter counter to advance
+ * @param[in] ticks   number of ticks that elapsed since last call
+ *
+ * Lets a timer interrupt that was held off catch up on the ticks it missed.
+ */
+void Os_CounterIsr(Os_CounterType counter, Os_TickType ticks)
+{
+    Os_ContextType context = Os_IsrEnter();
+    (void)Os_AdvanceCounter_Internal(counter, ticks);
+    Os_IsrExit(context);
+}
+
+#ifdef OS_ISR_COUNT
+/**
+ * @brief Run a category 2 interrupt handler
+ * @param[in] isr interrupt to run the handler of
+ *
+ * Called by the arch with interrupts disabled. The handler runs with
+ * interrupts enabled, so interrupts the arch lets through at the priority
+ * of this one may nest inside it. It may activate tasks, set events and
+ * take resources. Tasks it readies only get the cpu once the outermost
+ * interrupt has returned.
+ *
+ * Resources are taken on behalf of the interrupted task, any the handler
+ * still holds on return are reported and released.
+ */
+void Os_Isr2(Os_IsrType isr)
+{
+    Os_ContextType  context;
+    Os_ResourceType resource;
+
+    OS_CHECK_EXT(isr < OS_ISR_COUNT, E_OS_ID);
+
+    context  = Os_IsrEnter();
+    resource = Os_TaskControls[Os_ActiveTask].resource;
+
+    Os_Arch_EnableAllInterrupts();
+    Os_IsrConfigs[isr].entry();
+    Os_Arch_DisableAllInterrupts();
+
+    while (Os_TaskControls[Os_ActiveTask].resource != resource) {
+        Os_Error.service = OSServiceId_None;
+        OS_ERRORCHECK_DATA(E_OS_RESOURCE)
+        OS_ERRORHOOK(E_OS_RESOURCE);
+        (void)Os_ReleaseResource_Internal(Os_TaskControls[Os_ActiveTask].resource);
+    }
+
+    Os_IsrExit(context);
+}
+#endif
+
 void Os_Isr(void)
 {
-    Os_CallContext = OS_CONTEXT_ISR1;
-    Os_IncrementCounter_Internal(0u);
-    Os_Schedule_Internal();
-    Os_CallContext = OS_CONTEXT_TASK;
+    Os_CounterIsr(OS_COUNTER_SYSTEM, 1u);
 }
 
 /**
@@ -479,9 +1156,8 @@ void Os_Isr(void)
  *  - E_OK on success
  *  - E_OS_LIMIT if activation is already zero
  *  - E_OS_RESOURCE if still holding a resource
- *  - E_OS_* see Os_Schedule_Internal()
  *
- * The function will terminate the calling task and transfer execution to
+ * The function will terminate the calling task and request a dispatch to
  * next in line to execute. If task already have a queued activation it
  * will be put into end end of the ready list again.
  *
@@ -502,7 +1178,8 @@ Os_StatusType Os_TerminateTask_Internal(void)
     }
 #endif
 
-    return Os_Schedule_Internal();
+    Os_DispatchPending = TRUE;
+    return E_OK;
 
 OS_ERRORCHECK_EXIT_POINT:
     Os_Error.service = OSServiceId_TerminateTask;
@@ -516,7 +1193,6 @@ OS_ERRORCHECK_EXIT_POINT:
  *  - E_OK on success
  *  - E_OS_LIMIT if activation is already zero
  *  - E_OS_RESOURCE if still holding a resource
- *  - E_OS_* see Os_Schedule_Internal()
  *
  * This service causes the termination of the calling task. After
  * termination of the calling task a succeeding task <TaskID> is
@@ -557,6 +1233,12 @@ Os_StatusType Os_ChainTask_Internal(Os_TaskType task)
     OS_CHECK_EXT_R(Os_TaskControls[Os_ActiveTask].resource == OS_INVALID_RESOURCE , E_OS_RESOURCE);
     OS_CHECK_EXT_R(task < OS_TASK_COUNT                                           , E_OS_ID);
 
+    /* chaining self with nothing else ready at or above it, just start over */
+    if ((task == Os_ActiveTask) && (Os_TaskReadyHighest < Os_TaskConfigs[task].priority)) {
+        Os_State_Running_Restart(task);
+        return E_OK;
+    }
+
     Os_State_Running_To_Suspended(Os_ActiveTask);
 
 #if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) ||  (OS_CONFORMANCE == OS_CONFORMANCE_BCC2) )
@@ -579,7 +1261,8 @@ Os_StatusType Os_ChainTask_Internal(Os_TaskType task)
     Os_State_Suspended_To_Ready(task);
 #endif
 
-    return Os_Schedule_Internal();
+    Os_DispatchPending = TRUE;
+    return E_OK;
 
 OS_ERRORCHECK_EXIT_POINT:
     Os_Error.service   = OSServiceId_ChainTask;
@@ -594,7 +1277,6 @@ OS_ERRORCHECK_EXIT_POINT:
  * @return
  *  - E_OK on success
  *  - E_OS_LIMIT if maximum activations have been reached
- *  - E_OS_* (see Os_Schedule_Internal)
  *
  * This will transfer a task from a suspended state to a ready state.
  *
@@ -615,7 +1297,7 @@ static Os_StatusType Os_ActivateTask_Internal(Os_TaskType task)
     OS_CHECK_EXT_R(Os_TaskControls[task].state == OS_TASK_SUSPENDED, E_OS_LIMIT);
     Os_State_Suspended_To_Ready(task);
 #endif
-    return Os_Schedule_Internal();
+    return E_OK;
 
 OS_ERRORCHECK_EXIT_POINT:
     Os_Error.service   = OSServiceId_ActivateTask;
@@ -692,7 +1374,9 @@ Os_StatusType Os_ReleaseResource_Internal(Os_ResourceType res)
         Os_TaskControls[Os_ActiveTask].priority = Os_ResourceConfigs[Os_TaskControls[Os_ActiveTask].resource].priority;
     }
 
-    return Os_Schedule_Internal();
+    /* running priority lowered, so a ready task may now preempt */
+    Os_DispatchPending = TRUE;
+    return E_OK;
 
 OS_ERRORCHECK_EXIT_POINT:
     Os_Error.service   = OSServiceId_ReleaseResource;
@@ -701,6 +1385,269 @@ OS_ERRORCHECK_EXIT_POINT:
     return Os_Error.status;
 }
 
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC1) ||  (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) )
+
+/**
+ * @brief Set events of a task that is not suspended and wake it if it waits for any of them
+ * @return TRUE if the task was made ready
+ */
+static __inline boolean Os_EventSet(Os_TaskType task, Os_EventMaskType mask)
+{
+    Os_TaskControls[task].events |= mask;
+    if ((Os_TaskControls[task].state == OS_TASK_WAITING)
+    &&  (Os_TaskControls[task].events & Os_TaskControls[task].wait)) {
+#ifdef OS_ALARM_COUNT
+        /* disarm the timeout, directly through its queue index */
+        if (Os_AlarmControls[OS_ALARM_TIMEOUT_FIRST + task].queued) {
+            Os_AlarmRemove((Os_AlarmType)(OS_ALARM_TIMEOUT_FIRST + task));
+        }
+#endif
+        Os_State_Waiting_To_Ready(task);
+        return TRUE;
+    }
+    return FALSE;
+}
+
+/**
+ * @brief Set events of an extended task
+ * @param[in] task Task to set events for
+ * @param[in] mask Events to set
+ * @return
+ *  - E_OK        No error
+ *  - E_OS_ID     Task <task> is invalid
+ *  - E_OS_ACCESS Task <task> is not an extended task
+ *  - E_OS_STATE  Task <task> is suspended
+ *
+ * If the task waits for any of the events it becomes ready again, and a
+ * dispatch is requested if it should preempt the running task.
+ *
+ * Call contexts: TASK, ISR2
+ */
+static Os_StatusType Os_SetEvent_Internal(Os_TaskType task, Os_EventMaskType mask)
+{
+    OS_CHECK_EXT_R(task < OS_TASK_COUNT                                  , E_OS_ID);
+    OS_CHECK_EXT_R(Os_TaskConfigs[task].extended                         , E_OS_ACCESS);
+    OS_CHECK_EXT_R(Os_TaskControls[task].state != OS_TASK_SUSPENDED      , E_OS_STATE);
+
+    if (Os_EventSet(task, mask)) {
+        Os_ReadyPreempt(Os_TaskControls[task].priority);
+    }
+    return E_OK;
+
+OS_ERRORCHECK_EXIT_POINT:
+    Os_Error.service   = OSServiceId_SetEvent;
+    Os_Error.params[0] = task;
+    Os_Error.params[1] = mask;
+    OS_ERRORHOOK(Os_Error.status);
+    return Os_Error.status;
+}
+
+#ifdef OS_TASKGROUP_COUNT
+/**
+ * @brief Set events of every member of a task group
+ * @param[in] group Task group to set events for
+ * @param[in] mask  Events to set
+ * @return
+ *  - E_OK        No error
+ *  - E_OS_ID     Task group <group> is invalid
+ *
+ * Same as Os_SetEvent on each member in one call, except that suspended
+ * members are skipped instead of refused. The woken members are checked
+ * against the running task once, after all of them are in the ready
+ * lists, and the syscall exit dispatches once for the whole group.
+ *
+ * Call contexts: TASK, ISR2
+ */
+Os_StatusType Os_SetEventGroup_Internal(Os_TaskGroupType group, Os_EventMaskType mask)
+{
+    const Os_TaskGroupConfigType* config;
+    Os_PriorityType               top = -1;
+    Os_TaskType                   index;
+    Os_TaskType                   task;
+
+    OS_CHECK_EXT_R(group < OS_TASKGROUP_COUNT, E_OS_ID);
+
+    config = &Os_TaskGroupConfigs[group];
+    for (index = 0u; index < config->count; ++index) {
+        task = config->tasks[index];
+        if ((Os_TaskControls[task].state != OS_TASK_SUSPENDED)
+        &&  Os_EventSet(task, mask)
+        &&  (Os_TaskControls[task].priority > top)) {
+            top = Os_TaskControls[task].priority;
+        }
+    }
+
+    if (top >= 0) {
+        Os_ReadyPreempt(top);
+    }
+    return E_OK;
+
+OS_ERRORCHECK_EXIT_POINT:
+    Os_Error.service   = OSServiceId_SetEventGroup;
+    Os_Error.params[0] = group;
+    Os_Error.params[1] = mask;
+    OS_ERRORHOOK(Os_Error.status);
+    return Os_Error.status;
+}
+#endif
+
+/**
+ * @brief Clear events of the calling task
+ * @param[in] mask Events to clear
+ * @return
+ *  - E_OK          No error
+ *  - E_OS_ACCESS   Calling task is not an extended task
+ *  - E_OS_CALLEVEL Call at interrupt level
+ *
+ * Call contexts: TASK
+ */
+Os_StatusType Os_ClearEvent_Internal(Os_EventMaskType mask)
+{
+    OS_CHECK_EXT_R(Os_CallContext == OS_CONTEXT_TASK                     , E_OS_CALLEVEL);
+    OS_CHECK_EXT_R(Os_TaskConfigs[Os_ActiveTask].extended                , E_OS_ACCESS);
+
+    Os_TaskControls[Os_ActiveTask].events &= (Os_EventMaskType)~mask;
+    return E_OK;
+
+OS_ERRORCHECK_EXIT_POINT:
+    Os_Error.service   = OSServiceId_ClearEvent;
+    Os_Error.params[0] = mask;
+    OS_ERRORHOOK(Os_Error.status);
+    return Os_Error.status;
+}
+
+/**
+ * @brief Get the events set for an extended task
+ * @param[in]  task Task to query
+ * @param[out] mask Events currently set
+ * @return
+ *  - E_OK        No error
+ *  - E_OS_ID     Task <task> is invalid
+ *  - E_OS_ACCESS Task <task> is not an extended task
+ *  - E_OS_STATE  Task <task> is suspended
+ *
+ * Call contexts: TASK, ISR2, HOOKS
+ */
+Os_StatusType Os_GetEvent_Internal(Os_TaskType task, Os_EventMaskType* mask)
+{
+    OS_CHECK_EXT_R(task < OS_TASK_COUNT                                  , E_OS_ID);
+    OS_CHECK_EXT_R(Os_TaskConfigs[task].extended                         , E_OS_ACCESS);
+    OS_CHECK_EXT_R(Os_TaskControls[task].state != OS_TASK_SUSPENDED      , E_OS_STATE);
+
+    *mask = Os_TaskControls[task].events;
+    return E_OK;
+
+OS_ERRORCHECK_EXIT_POINT:
+    Os_Error.service   = OSServiceId_GetEvent;
+    Os_Error.params[0] = task;
+    OS_ERRORHOOK(Os_Error.status);
+    return Os_Error.status;
+}
+
+/**
+ * @brief Wait for any of the given events
+ * @param[in] mask Events to wait for
+ * @return
+ *  - E_OK          No error
+ *  - E_OS_ACCESS   Calling task is not an extended task
+ *  - E_OS_RESOURCE Calling task still occupies resources
+ *  - E_OS_CALLEVEL Call at interrupt level
+ *
+ * If none of the events is set, the calling task enters the waiting state
+ * and gives up the cpu until Os_SetEvent sets one of them. A waiting task
+ * is in no ready list, it costs nothing until then.
+ *
+ * Call contexts: TASK
+ */
+Os_StatusType Os_WaitEvent_Internal(Os_EventMaskType mask)
+{
+    OS_CHECK_EXT_R(Os_CallContext == OS_CONTEXT_TASK                              , E_OS_CALLEVEL);
+    OS_CHECK_EXT_R(Os_TaskConfigs[Os_ActiveTask].extended                         , E_OS_ACCESS);
+    OS_CHECK_EXT_R(Os_TaskControls[Os_ActiveTask].resource == OS_INVALID_RESOURCE , E_OS_RESOURCE);
+
+    Os_TaskControls[Os_ActiveTask].wait    = mask;
+    Os_TaskControls[Os_ActiveTask].timeout = FALSE;
+    if ((Os_TaskControls[Os_ActiveTask].events & mask) == 0u) {
+        Os_State_Running_To_Waiting(Os_ActiveTask);
+        Os_DispatchPending = TRUE;
+    }
+    return E_OK;
+
+OS_ERRORCHECK_EXIT_POINT:
+    Os_Error.service   = OSServiceId_WaitEvent;
+    Os_Error.params[0] = mask;
+    OS_ERRORHOOK(Os_Error.status);
+    return Os_Error.status;
+}
+
+#ifdef OS_ALARM_COUNT
+
+/**
+ * @brief Wake a task whose wait timed out
+ * @param task task the expired timeout belongs to
+ */
+static void Os_EventTimeout(Os_TaskType task)
+{
+    if (Os_TaskControls[task].state == OS_TASK_WAITING) {
+        Os_TaskControls[task].timeout = TRUE;
+        Os_State_Waiting_To_Ready(task);
+        Os_ReadyPreempt(Os_TaskControls[task].priority);
+    }
+}
+
+/**
+ * @brief Wait for any of the given events, at most a number of ticks
+ * @param[in] mask  Events to wait for
+ * @param[in] ticks Ticks of OS_COUNTER_SYSTEM to wait at most
+ * @return
+ *  - E_OK             An event was set
+ *  - E_OS_SYS_TIMEOUT No event was set within <ticks>
+ *  - E_OS_VALUE       Value of <ticks> is zero
+ *  - E_OS_ACCESS      Calling task is not an extended task
+ *  - E_OS_RESOURCE    Calling task still occupies resources
+ *  - E_OS_CALLEVEL    Call at interrupt level
+ *
+ * Same as Os_WaitEvent, but the timeout alarm every task owns is armed
+ * while waiting. Setting an event removes it from the counter queue
+ * through its queue index, so no alarm is searched for either way.
+ *
+ * The kernel side returns E_OK when the task starts waiting, the wrapper
+ * Os_WaitEventTimeout reports E_OS_SYS_TIMEOUT once the task runs again.
+ *
+ * Call contexts: TASK
+ */
+Os_StatusType Os_WaitEventTimeout_Internal(Os_EventMaskType mask, Os_TickType ticks)
+{
+    Os_AlarmType alarm = (Os_AlarmType)(OS_ALARM_TIMEOUT_FIRST + Os_ActiveTask);
+
+    OS_CHECK_EXT_R(Os_CallContext == OS_CONTEXT_TASK                              , E_OS_CALLEVEL);
+    OS_CHECK_EXT_R(Os_TaskConfigs[Os_ActiveTask].extended                         , E_OS_ACCESS);
+    OS_CHECK_EXT_R(Os_TaskControls[Os_ActiveTask].resource == OS_INVALID_RESOURCE , E_OS_RESOURCE);
+    OS_CHECK_R    (ticks != 0u                                                    , E_OS_VALUE);
+
+    Os_TaskControls[Os_ActiveTask].wait    = mask;
+    Os_TaskControls[Os_ActiveTask].timeout = FALSE;
+    if ((Os_TaskControls[Os_ActiveTask].events & mask) == 0u) {
+        Os_AlarmControls[alarm].cycle = 0u;
+        Os_AlarmControls[alarm].ticks = Os_CounterControls[OS_COUNTER_SYSTEM].ticks + ticks;
+        Os_AlarmAdd(alarm);
+        Os_State_Running_To_Waiting(Os_ActiveTask);
+        Os_DispatchPending = TRUE;
+    }
+    return E_OK;
+
+OS_ERRORCHECK_EXIT_POINT:
+    Os_Error.service   = OSServiceId_WaitEventTimeout;
+    Os_Error.params[0] = mask;
+    Os_Error.params[1] = ticks;
+    OS_ERRORHOOK(Os_Error.status);
+    return Os_Error.status;
+}
+
+#endif /* OS_ALARM_COUNT */
+
+#endif
+
 #ifdef OS_ALARM_COUNT
 
 /**
@@ -709,9 +1656,12 @@ OS_ERRORCHECK_EXIT_POINT:
  */
 void Os_AlarmInit(Os_AlarmType alarm)
 {
-    Os_AlarmCycles[alarm]  = 0u;
-    Os_AlarmTicks [alarm]  = 0u;
-    Os_AlarmQueued[alarm] = FALSE;
+    memset(&Os_AlarmControls[alarm], 0, sizeof(Os_AlarmControls[alarm]));
+    Os_AlarmControls[alarm].queued = FALSE;
+#if(OS_ALARM_WHEEL_ENABLE)
+    Os_AlarmControls[alarm].next   = OS_INVALID_ALARM;
+    Os_AlarmControls[alarm].prev   = OS_INVALID_ALARM;
+#endif
 }
 
 /**
@@ -750,12 +1700,11 @@ Os_StatusType Os_SetRelAlarm_Internal(Os_AlarmType alarm, Os_TickType increment,
 {
     OS_CHECK_EXT_R(alarm < OS_ALARM_COUNT             , E_OS_ID);
     OS_CHECK_R    (increment != 0u                    , E_OS_VALUE); /**< @req SWS_Os_00304 */
-    OS_CHECK_R    (Os_AlarmTicks[alarm] == 0u, E_OS_STATE); /* TODO can fail this check */
+    OS_CHECK_R    (Os_AlarmControls[alarm].queued == FALSE, E_OS_STATE);
 
-    Os_AlarmCycles[alarm] = cycle;
-    Os_AlarmTicks [alarm] = Os_CounterControls[Os_AlarmConfigs[alarm].counter].ticks + increment;
-    Os_AlarmAdd( Os_CounterControls[Os_AlarmConfigs[alarm].counter].queue
-              ,  alarm);
+    Os_AlarmControls[alarm].cycle = cycle;
+    Os_AlarmControls[alarm].ticks = Os_CounterControls[Os_AlarmConfigs[alarm].counter].ticks + increment;
+    Os_AlarmAdd(alarm);
     return E_OK;
 
 OS_ERRORCHECK_EXIT_POINT:
@@ -807,13 +1756,12 @@ OS_ERRORCHECK_EXIT_POINT:
 Os_StatusType Os_SetAbsAlarm_Internal(Os_AlarmType alarm, Os_TickType start, Os_TickType cycle)
 {
     OS_CHECK_EXT_R(alarm < OS_ALARM_COUNT, E_OS_ID);
-    OS_CHECK_R    (Os_AlarmTicks[alarm] == 0u, E_OS_STATE); /* TODO can fail this check */
+    OS_CHECK_R    (Os_AlarmControls[alarm].queued == FALSE, E_OS_STATE);
 
-    Os_AlarmCycles[alarm] = cycle;
-    Os_AlarmTicks [alarm] = start;
-    Os_AlarmAdd( Os_CounterControls[Os_AlarmConfigs[alarm].counter].queue
-              ,  alarm);
-   return E_OK;
+    Os_AlarmControls[alarm].cycle = cycle;
+    Os_AlarmControls[alarm].ticks = start;
+    Os_AlarmAdd(alarm);
+    return E_OK;
 
 OS_ERRORCHECK_EXIT_POINT:
     Os_Error.service   = OSServiceId_SetAbsAlarm;
@@ -833,37 +1781,24 @@ OS_ERRORCHECK_EXIT_POINT:
  *
  * Call contexts: TASK, ISR2
  *
- * O(n)+O(log n)
+ * O(log n) on the heap, O(1) on the timing wheel
  */
 Os_StatusType Os_CancelAlarm_Internal(Os_AlarmType alarm)
 {
-    Os_AlarmQueueIndexType index;
-    Os_AlarmType*          queue;
+    Os_CounterType counter;
 
     OS_CHECK_EXT_R(alarm < OS_ALARM_COUNT            , E_OS_ID);
-    OS_CHECK_R(Os_AlarmQueued[alarm] == TRUE, E_OS_NOFUNC);
-
-    queue   = &Os_CounterControls[Os_AlarmConfigs[alarm].counter].queue[0];
+    OS_CHECK_R(Os_AlarmControls[alarm].queued == TRUE, E_OS_NOFUNC);
 
-    /* find the index of this node, must iterate all queue nodes */
-    for (index = 1u; index <= queue[0]; ++index) {
-        if (queue[index] == alarm) {
-            break;
-        }
-    }
-
-    /* just a defensive check here */
-    OS_CHECK_R(index <= queue[0], E_OS_NOFUNC);
-
-    /* if this is not the last item, we must swap and heapify */
-    if (queue[0] != index) {
-        queue[index] = queue[queue[0]];
-        queue[0]--;
-        Os_AlarmHeapify(queue, index);
-    } else {
-        queue[0]--;
+    counter = Os_AlarmConfigs[alarm].counter;
+#if(OS_ALARM_WHEEL_ENABLE)
+    if (!Os_AlarmWheelUsed(counter))
+#endif
+    {
+        /* just a defensive check here */
+        OS_CHECK_R(Os_CounterControls[counter].queue[Os_AlarmControls[alarm].index].alarm == alarm, E_OS_NOFUNC);
     }
-    Os_AlarmQueued[alarm] = FALSE;
+    Os_AlarmRemove(alarm);
 
     return E_OK;
 
@@ -892,9 +1827,9 @@ OS_ERRORCHECK_EXIT_POINT:
 Os_StatusType Os_GetAlarm_Internal(Os_AlarmType alarm, Os_TickType* tick)
 {
     OS_CHECK_EXT_R(alarm < OS_ALARM_COUNT, E_OS_ID);
-    OS_CHECK_R(Os_AlarmQueued[alarm] == TRUE, E_OS_NOFUNC);
+    OS_CHECK_R(Os_AlarmControls[alarm].queued == TRUE, E_OS_NOFUNC);
 
-    *tick = Os_AlarmTicks[alarm] - Os_CounterControls[Os_AlarmConfigs[alarm].counter].ticks;
+    *tick = Os_AlarmControls[alarm].ticks - Os_CounterControls[Os_AlarmConfigs[alarm].counter].ticks;
     return E_OK;
 
 OS_ERRORCHECK_EXIT_POINT:
@@ -904,60 +1839,568 @@ OS_ERRORCHECK_EXIT_POINT:
     return Os_Error.status;
 }
 
+/**
+ * @brief Set a batch of relative alarms in one call
+ * @param[in] alarms Alarms to set, each with increment and cycle as for Os_SetRelAlarm
+ * @param[in] count  Number of entries in alarms
+ * @return
+ *  - E_OK        No error
+ *  - E_OS_STATE  An alarm is already in use or listed twice
+ *  - E_OS_ID     An alarm is invalid
+ *  - E_OS_VALUE  An increment is zero, or count exceeds the number of alarms
+ *
+ * All entries are checked before anything is armed, if one is rejected no
+ * alarm is changed and the error parameters give the rejected alarm, its
+ * position in the batch and the batch size.
+ *
+ * Alarms on a heap counter are appended unordered and the heap order is
+ * restored once per counter, in O(n) when the batch is larger than the
+ * number of alarms already queued on that counter.
+ *
+ * Call contexts: TASK, ISR2
+ */
+Os_StatusType Os_SetRelAlarms_Internal(const Os_AlarmSetType* alarms, Os_AlarmType count)
+{
+    Os_AlarmQueueIndexType first[OS_COUNTER_COUNT];
+    Os_AlarmQueueEntryType entry;
+    Os_CounterControlType* control;
+    Os_CounterType         counter;
+    Os_AlarmType           alarm = OS_INVALID_ALARM;
+    Os_AlarmType           index = 0u;
+
+    OS_CHECK_EXT_R(count <= OS_ALARM_COUNT, E_OS_VALUE);
+
+    /* claim every alarm up front, so a rejected entry leaves all alarms as they were */
+    for (; index < count; ++index) {
+        alarm = alarms[index].alarm;
+        OS_CHECK_EXT_R(alarm < OS_ALARM_COUNT                 , E_OS_ID);
+        OS_CHECK_R    (alarms[index].increment != 0u          , E_OS_VALUE); /**< @req SWS_Os_00304 */
+        OS_CHECK_R    (Os_AlarmControls[alarm].queued == FALSE, E_OS_STATE);
+        Os_AlarmControls[alarm].queued = TRUE;
+    }
+
+    for (counter = 0u; counter < OS_COUNTER_COUNT; ++counter) {
+        first[counter] = Os_CounterControls[counter].count;
+    }
+
+    for (index = 0u; index < count; ++index) {
+        alarm   = alarms[index].alarm;
+        counter = Os_AlarmConfigs[alarm].counter;
+        control = &Os_CounterControls[counter];
+
+        Os_AlarmControls[alarm].cycle = alarms[index].cycle;
+        Os_AlarmControls[alarm].ticks = control->ticks + alarms[index].increment;
+#if(OS_ALARM_WHEEL_ENABLE)
+        if (Os_AlarmWheelUsed(counter)) {
+            Os_AlarmWheelAdd(control, alarm, (Os_TickType)(control->ticks + 1u));
+            continue;
+        }
+#endif
+        entry.tick  = Os_AlarmControls[alarm].ticks;
+        entry.alarm = alarm;
+        Os_AlarmPlace(control->queue, control->count, entry);
+        control->count++;
+    }
+
+    for (counter = 0u; counter < OS_COUNTER_COUNT; ++counter) {
+        if (Os_CounterControls[counter].count != first[counter]) {
+            Os_AlarmHeapMerge(&Os_CounterControls[counter], first[counter]);
+        }
+    }
+    return E_OK;
+
+OS_ERRORCHECK_EXIT_POINT:
+    Os_Error.service   = OSServiceId_SetRelAlarms;
+    Os_Error.params[0] = alarm;
+    Os_Error.params[1] = index;
+    Os_Error.params[2] = count;
+
+    /* release the alarms claimed before the rejected one */
+    while (index > 0u) {
+        --index;
+        Os_AlarmControls[alarms[index].alarm].queued = FALSE;
+    }
+    OS_ERRORHOOK(Os_Error.status);
+    return Os_Error.status;
+}
+
 #endif /* OS_ALARM_COUNT */
 
-#ifdef OS_COUNTER_COUNT
+#ifdef OS_SCHEDULETABLE_COUNT
 
 /**
- * @brief Initializes a counter to it's starting setup
- * @param counter Counter to initialize
+ * @brief Initialize the schedule table context
+ * @param table schedule table to initialize
  */
-void Os_CounterInit(Os_CounterType counter)
+void Os_ScheduleTableInit(Os_ScheduleTableType table)
 {
-    Os_AlarmQueueIndexType  index;
-    Os_CounterControls[counter].ticks = 0u;
+    Os_ScheduleTableControls[table].state = OS_SCHEDULETABLE_STOPPED;
+    Os_ScheduleTableControls[table].point = 0u;
+    Os_ScheduleTableControls[table].next  = OS_INVALID_SCHEDULETABLE;
+}
+
+/**
+ * @brief Queue the alarm of a schedule table for the first expiry point of a round
+ * @param table schedule table to start
+ * @param start tick the round starts at
+ */
+static void Os_ScheduleTableRun(Os_ScheduleTableType table, Os_TickType start)
+{
+    Os_AlarmType alarm = (Os_AlarmType)(OS_ALARM_COUNT + table);
+
+    Os_ScheduleTableControls[table].state = OS_SCHEDULETABLE_RUNNING;
+    Os_ScheduleTableControls[table].point = 0u;
+    Os_AlarmControls[alarm].cycle = 0u;
+    Os_AlarmControls[alarm].ticks = start + Os_ScheduleTableConfigs[table].points[0u].offset;
+    Os_AlarmAdd(alarm);
+}
+
+/**
+ * @brief Process the expiry point a schedule table alarm was queued for
+ * @param table schedule table whose alarm expired
+ *
+ * The tasks of the current expiry point are activated and the alarm of the
+ * table is made cyclic with the delay to the following point, so the
+ * counter queue requeues it like any cyclic alarm. Nothing is searched,
+ * each expiry point costs the same whatever the length of the table.
+ *
+ * After the final delay the round ends, and the next table takes over
+ * from the same tick, the table starts over if repeating or stops.
+ * Points that fall on the same tick are processed in the same call, so
+ * offsets must be strictly increasing and the duration past the last
+ * offset, as checked by Os_Init.
+ */
+static void Os_ScheduleTableExpire(Os_ScheduleTableType table)
+{
+    const Os_ScheduleTableConfigType* config;
+    const Os_ScheduleTableExpiryType* point;
+    Os_ScheduleTableControlType*      control;
+    Os_AlarmType                      expired = (Os_AlarmType)(OS_ALARM_COUNT + table);
+    Os_AlarmType                      alarm   = expired;
+    Os_TickType                       delay;
+    Os_TaskType                       index;
+
+    do {
+        config  = &Os_ScheduleTableConfigs[table];
+        control = &Os_ScheduleTableControls[table];
+
+        if (control->point < config->count) {
+            point = &config->points[control->point];
+            for (index = 0u; index < point->count; ++index) {
+                (void)Os_ActivateTask_Internal(point->tasks[index]);
+            }
+
+            control->point++;
+            if (control->point < config->count) {
+                delay = (Os_TickType)(config->points[control->point].offset - point->offset);
+            } else {
+                delay = (Os_TickType)(config->duration - point->offset);
+            }
+        } else if (control->next != OS_INVALID_SCHEDULETABLE) {
+            /* hand over to the next table, which starts at the end of this round */
+            Os_AlarmControls[alarm].cycle = 0u;
+            table = control->next;
+            Os_ScheduleTableInit((Os_ScheduleTableType)(alarm - OS_ALARM_COUNT));
+
+            Os_ScheduleTableControls[table].state = OS_SCHEDULETABLE_RUNNING;
+            Os_ScheduleTableControls[table].point = 0u;
+            Os_AlarmControls[OS_ALARM_COUNT + table].ticks = Os_AlarmControls[alarm].ticks;
+            alarm = (Os_AlarmType)(OS_ALARM_COUNT + table);
+            delay = Os_ScheduleTableConfigs[table].points[0u].offset;
+        } else if (config->repeating) {
+            control->point = 0u;
+            delay = config->points[0u].offset;
+        } else {
+            Os_AlarmControls[alarm].cycle = 0u;
+            Os_ScheduleTableInit(table);
+            return;
+        }
+    } while (delay == 0u);
 
-    for (index = 1u; index < OS_ALARM_COUNT+1u; ++index) {
-        Os_CounterControls[counter].queue[index] = OS_INVALID_ALARM;
+    if (alarm == expired) {
+        Os_AlarmControls[alarm].cycle = delay;
+    } else {
+        Os_AlarmControls[alarm].cycle  = 0u;
+        Os_AlarmControls[alarm].ticks += delay;
+        Os_AlarmAdd(alarm);
     }
-    Os_CounterControls[counter].queue[0] = 0u;
 }
 
 /**
- * @brief Increment given counter by one and trigger any alarms linked to it
- * @param[in] counter Counter to increment
+ * @brief Start a schedule table at a relative offset from now
+ * @param[in] table  Schedule table to start
+ * @param[in] offset Ticks from now to the start of the table
+ * @return
+ *  - E_OK        No error
+ *  - E_OS_ID     Schedule table <table> is invalid
+ *  - E_OS_VALUE  Value of <offset> is zero
+ *  - E_OS_STATE  Schedule table <table> is not stopped
+ *
+ * The first expiry point is processed <offset> ticks plus the offset of
+ * that point from now.
+ *
+ * Call contexts: TASK, ISR2
  */
-Os_StatusType Os_IncrementCounter_Internal(Os_CounterType counter)
+Os_StatusType Os_StartScheduleTableRel_Internal(Os_ScheduleTableType table, Os_TickType offset)
 {
-    OS_CHECK_EXT_R(counter < OS_COUNTER_COUNT, E_OS_VALUE);
-    Os_CounterControls[counter].ticks++;
-    Os_AlarmTick(Os_CounterControls[counter].queue);
+    OS_CHECK_EXT_R(table < OS_SCHEDULETABLE_COUNT, E_OS_ID);
+    OS_CHECK_R    (offset != 0u                  , E_OS_VALUE); /**< @req SWS_Os_00332 */
+    OS_CHECK_R    (Os_ScheduleTableControls[table].state == OS_SCHEDULETABLE_STOPPED, E_OS_STATE);
+
+    Os_ScheduleTableRun(table, Os_CounterControls[Os_ScheduleTableConfigs[table].counter].ticks + offset);
     return E_OK;
 
 OS_ERRORCHECK_EXIT_POINT:
-    Os_Error.service   = OSServiceId_CounterIncrement;
-    Os_Error.params[0] = counter;
+    Os_Error.service   = OSServiceId_StartScheduleTableRel;
+    Os_Error.params[0] = table;
+    Os_Error.params[1] = offset;
     OS_ERRORHOOK(Os_Error.status);
     return Os_Error.status;
 }
 
-#endif /* OS_COUNTER_COUNT */
+/**
+ * @brief Start a schedule table at an absolute counter value
+ * @param[in] table Schedule table to start
+ * @param[in] start Counter value the table starts at
+ * @return
+ *  - E_OK        No error
+ *  - E_OS_ID     Schedule table <table> is invalid
+ *  - E_OS_STATE  Schedule table <table> is not stopped
+ *
+ * As for Os_SetAbsAlarm, an expiry point whose tick already passed is
+ * processed on the next counter tick.
+ *
+ * Call contexts: TASK, ISR2
+ */
+Os_StatusType Os_StartScheduleTableAbs_Internal(Os_ScheduleTableType table, Os_TickType start)
+{
+    OS_CHECK_EXT_R(table < OS_SCHEDULETABLE_COUNT, E_OS_ID);
+    OS_CHECK_R    (Os_ScheduleTableControls[table].state == OS_SCHEDULETABLE_STOPPED, E_OS_STATE);
+
+    Os_ScheduleTableRun(table, start);
+    return E_OK;
+
+OS_ERRORCHECK_EXIT_POINT:
+    Os_Error.service   = OSServiceId_StartScheduleTableAbs;
+    Os_Error.params[0] = table;
+    Os_Error.params[1] = start;
+    OS_ERRORHOOK(Os_Error.status);
+    return Os_Error.status;
+}
+
+/**
+ * @brief Stop a schedule table
+ * @param[in] table Schedule table to stop
+ * @return
+ *  - E_OK        No error
+ *  - E_OS_ID     Schedule table <table> is invalid
+ *  - E_OS_NOFUNC Schedule table <table> is already stopped
+ *
+ * A running table is stopped right away along with any table queued to
+ * follow it. A table queued as next is removed from its predecessor.
+ *
+ * Call contexts: TASK, ISR2
+ */
+Os_StatusType Os_StopScheduleTable_Internal(Os_ScheduleTableType table)
+{
+    Os_ScheduleTableControlType* control;
+    Os_ScheduleTableType         other;
+
+    OS_CHECK_EXT_R(table < OS_SCHEDULETABLE_COUNT, E_OS_ID);
+    control = &Os_ScheduleTableControls[table];
+    OS_CHECK_R    (control->state != OS_SCHEDULETABLE_STOPPED, E_OS_NOFUNC);
+
+    if (control->state == OS_SCHEDULETABLE_RUNNING) {
+        Os_AlarmRemove((Os_AlarmType)(OS_ALARM_COUNT + table));
+        if (control->next != OS_INVALID_SCHEDULETABLE) {
+            Os_ScheduleTableControls[control->next].state = OS_SCHEDULETABLE_STOPPED;
+        }
+    } else {
+        for (other = 0u; other < OS_SCHEDULETABLE_COUNT; ++other) {
+            if (Os_ScheduleTableControls[other].next == table) {
+                Os_ScheduleTableControls[other].next = OS_INVALID_SCHEDULETABLE;
+            }
+        }
+    }
+    Os_ScheduleTableInit(table);
+    return E_OK;
+
+OS_ERRORCHECK_EXIT_POINT:
+    Os_Error.service   = OSServiceId_StopScheduleTable;
+    Os_Error.params[0] = table;
+    OS_ERRORHOOK(Os_Error.status);
+    return Os_Error.status;
+}
+
+/**
+ * @brief Queue a schedule table to start when another one ends its round
+ * @param[in] from Running schedule table
+ * @param[in] to   Schedule table to start after <from>
+ * @return
+ *  - E_OK        No error
+ *  - E_OS_ID     <from> or <to> is invalid, or they are driven by different counters
+ *  - E_OS_NOFUNC <from> is not running
+ *  - E_OS_STATE  <to> is not stopped
+ *
+ * A table already queued after <from> is stopped and replaced.
+ *
+ * Call contexts: TASK, ISR2
+ */
+Os_StatusType Os_NextScheduleTable_Internal(Os_ScheduleTableType from, Os_ScheduleTableType to)
+{
+    Os_ScheduleTableControlType* control;
+
+    OS_CHECK_EXT_R(from < OS_SCHEDULETABLE_COUNT, E_OS_ID);
+    OS_CHECK_EXT_R(to   < OS_SCHEDULETABLE_COUNT, E_OS_ID);
+    OS_CHECK_EXT_R(Os_ScheduleTableConfigs[from].counter == Os_ScheduleTableConfigs[to].counter, E_OS_ID);
+    control = &Os_ScheduleTableControls[from];
+    OS_CHECK_R    (control->state == OS_SCHEDULETABLE_RUNNING, E_OS_NOFUNC);
+    OS_CHECK_R    (Os_ScheduleTableControls[to].state == OS_SCHEDULETABLE_STOPPED, E_OS_STATE);
+
+    if (control->next != OS_INVALID_SCHEDULETABLE) {
+        Os_ScheduleTableControls[control->next].state = OS_SCHEDULETABLE_STOPPED;
+    }
+    control->next = to;
+    Os_ScheduleTableControls[to].state = OS_SCHEDULETABLE_NEXT;
+    return E_OK;
+
+OS_ERRORCHECK_EXIT_POINT:
+    Os_Error.service   = OSServiceId_NextScheduleTable;
+    Os_Error.params[0] = from;
+    Os_Error.params[1] = to;
+    OS_ERRORHOOK(Os_Error.status);
+    return Os_Error.status;
+}
+
+/**
+ * @brief Get the state of a schedule table
+ * @param[in]  table  Schedule table to query
+ * @param[out] status State of the table
+ * @return
+ *  - E_OK        No error
+ *  - E_OS_ID     Schedule table <table> is invalid
+ *
+ * Call contexts: TASK, ISR2
+ */
+Os_StatusType Os_GetScheduleTableStatus_Internal(Os_ScheduleTableType table, Os_ScheduleTableStatusType* status)
+{
+    OS_CHECK_EXT_R(table < OS_SCHEDULETABLE_COUNT, E_OS_ID);
+
+    *status = Os_ScheduleTableControls[table].state;
+    return E_OK;
+
+OS_ERRORCHECK_EXIT_POINT:
+    Os_Error.service   = OSServiceId_GetScheduleTableStatus;
+    Os_Error.params[0] = table;
+    OS_ERRORHOOK(Os_Error.status);
+    return Os_Error.status;
+}
+
+#endif /* OS_SCHEDULETABLE_COUNT */
+
+#ifdef OS_COUNTER_COUNT
+
+/**
+ * @brief Split the alarm queue pool into one slice per counter
+ *
+ * Each counter gets room for exactly the alarms configured on it, so the
+ * queues take OS_ALARM_QUEUE_COUNT entries in total whatever the number of
+ * counters, and the alarms of one counter sit next to each other.
+ */
+static void Os_CounterQueueLayout(void)
+{
+    Os_AlarmType           alarm;
+    Os_CounterType         counter;
+    Os_AlarmQueueIndexType first = 0u;
+
+    for (counter = 0u; counter < OS_COUNTER_COUNT; ++counter) {
+        Os_CounterControls[counter].size = 0u;
+    }
+
+    for (alarm = 0u; alarm < OS_ALARM_QUEUE_COUNT; ++alarm) {
+        Os_CounterControls[Os_AlarmCounter(alarm)].size++;
+    }
+
+    for (counter = 0u; counter < OS_COUNTER_COUNT; ++counter) {
+        Os_CounterControls[counter].queue = &Os_AlarmQueuePool[first];
+        first += Os_CounterControls[counter].size;
+    }
+}
+
+/**
+ * @brief Initializes a counter to it's starting setup
+ * @param counter Counter to initialize
+ */
+void Os_CounterInit(Os_CounterType counter)
+{
+    Os_AlarmQueueIndexType  index;
+#if(OS_ALARM_WHEEL_ENABLE)
+    uint16                  slot;
+#endif
+    Os_CounterControls[counter].ticks = 0u;
+
+    for (index = 0u; index < Os_CounterControls[counter].size; ++index) {
+        Os_CounterControls[counter].queue[index].tick  = 0u;
+        Os_CounterControls[counter].queue[index].alarm = OS_INVALID_ALARM;
+    }
+    Os_CounterControls[counter].count = 0u;
+
+#if(OS_ALARM_WHEEL_ENABLE)
+    for (slot = 0u; slot < OS_ALARM_WHEEL_LEVELS * OS_ALARM_WHEEL_SLOTS; ++slot) {
+        Os_CounterControls[counter].wheel[slot] = OS_INVALID_ALARM;
+    }
+#endif
+}
+
+/**
+ * @brief Increment given counter by one and trigger any alarms linked to it
+ * @param[in] counter Counter to increment
+ */
+Os_StatusType Os_IncrementCounter_Internal(Os_CounterType counter)
+{
+    OS_CHECK_EXT_R(counter < OS_COUNTER_COUNT, E_OS_VALUE);
+    Os_AlarmAdvance(counter, 1u);
+    return E_OK;
+
+OS_ERRORCHECK_EXIT_POINT:
+    Os_Error.service   = OSServiceId_CounterIncrement;
+    Os_Error.params[0] = counter;
+    OS_ERRORHOOK(Os_Error.status);
+    return Os_Error.status;
+}
+
+/**
+ * @brief Advance given counter by a number of ticks and trigger any alarms linked to it
+ * @param[in] counter Counter to advance
+ * @param[in] ticks   Number of ticks to advance counter by
+ * @return
+ *  - E_OK       No error
+ *  - E_OS_VALUE Counter is invalid or ticks is zero
+ *
+ * Same as calling Os_IncrementCounter_Internal ticks times, alarms expire
+ * in order and cyclic alarms may expire several times. Used to catch up
+ * on ticks that were missed or to drive counters by a measured delta.
+ *
+ * Call contexts: TASK, ISR2
+ */
+Os_StatusType Os_AdvanceCounter_Internal(Os_CounterType counter, Os_TickType ticks)
+{
+    OS_CHECK_EXT_R(counter < OS_COUNTER_COUNT, E_OS_VALUE);
+    OS_CHECK_R    (ticks != 0u               , E_OS_VALUE);
+    Os_AlarmAdvance(counter, ticks);
+    return E_OK;
+
+OS_ERRORCHECK_EXIT_POINT:
+    Os_Error.service   = OSServiceId_CounterAdvance;
+    Os_Error.params[0] = counter;
+    Os_Error.params[1] = ticks;
+    OS_ERRORHOOK(Os_Error.status);
+    return Os_Error.status;
+}
+
+#endif /* OS_COUNTER_COUNT */
+
+/**
+ * @brief Refuse a service called from a context it is not allowed in
+ *
+ * Alarm callbacks run inside the kernel while a counter is advanced, so no
+ * service is performed nor followed by a dispatch. Interrupt handlers may
+ * not reschedule.
+ */
+static Os_StatusType Os_Syscall_CallLevel(Os_ServiceIdType service)
+{
+    OS_ERRORCHECK_DATA(E_OS_CALLEVEL)
+    Os_Error.service = service;
+    OS_ERRORHOOK(Os_Error.status);
+    return Os_Error.status;
+}
+
+/**
+ * @brief Schedule with the internal resource of the calling task released
+ */
+static Os_StatusType Os_Syscall_Schedule(void)
+{
+    Os_StatusType res;
+    if (Os_Unlikely(Os_IsrNesting != 0u)) {
+        return Os_Syscall_CallLevel(OSServiceId_Schedule);
+    }
+    Os_TaskInternalResource_Release();
+    res = Os_Schedule_Internal();
+    Os_TaskInternalResource_Get();
+    return res;
+}
+
+/**
+ * @brief Terminate calling task and switch to the next, which takes its internal resource
+ */
+static Os_StatusType Os_Syscall_TerminateTask(void)
+{
+    Os_StatusType res;
+    Os_TaskInternalResource_Release();
+    res = Os_TerminateTask_Internal();
+    (void)Os_Dispatch();
+    Os_TaskInternalResource_Get();
+    return res;
+}
+
+/**
+ * @brief Chain calling task and switch to the next, which takes its internal resource
+ */
+static Os_StatusType Os_Syscall_ChainTask(Os_TaskType task)
+{
+    Os_StatusType res;
+    Os_TaskInternalResource_Release();
+    res = Os_ChainTask_Internal(task);
+    (void)Os_Dispatch();
+    Os_TaskInternalResource_Get();
+    return res;
+}
+
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC1) ||  (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) )
+/**
+ * @brief Wait for events and switch to the next task, the internal resource is given up while waiting
+ */
+static Os_StatusType Os_Syscall_WaitEvent(Os_EventMaskType mask)
+{
+    Os_StatusType res;
+    Os_TaskInternalResource_Release();
+    res = Os_WaitEvent_Internal(mask);
+    (void)Os_Dispatch();
+    Os_TaskInternalResource_Get();
+    return res;
+}
+
+#ifdef OS_ALARM_COUNT
+/**
+ * @brief Wait for events with a timeout and switch to the next task, as Os_Syscall_WaitEvent
+ */
+static Os_StatusType Os_Syscall_WaitEventTimeout(Os_EventMaskType mask, Os_TickType ticks)
+{
+    Os_StatusType res;
+    Os_TaskInternalResource_Release();
+    res = Os_WaitEventTimeout_Internal(mask, ticks);
+    (void)Os_Dispatch();
+    Os_TaskInternalResource_Get();
+    return res;
+}
+#endif
+#endif
 
 Os_StatusType Os_Syscall_Internal(Os_SyscallParamType* param)
 {
     Os_StatusType res;
+    if (Os_Unlikely(Os_CallContext == OS_CONTEXT_ALARMCALLBACK)) {
+        return Os_Syscall_CallLevel(param->service);
+    }
+
     switch (param->service) {
         case OSServiceId_Schedule: {
-            Os_TaskInternalResource_Release();
-            res = Os_Schedule_Internal();
-            Os_TaskInternalResource_Get();
+            res = Os_Syscall_Schedule();
             break;
         }
 
         case OSServiceId_TerminateTask: {
-            Os_TaskInternalResource_Release();
-            res = Os_TerminateTask_Internal();
-            Os_TaskInternalResource_Get();
+            res = Os_Syscall_TerminateTask();
             break;
         }
 
@@ -967,9 +2410,7 @@ Os_StatusType Os_Syscall_Internal(Os_SyscallParamType* param)
         }
 
         case OSServiceId_ChainTask: {
-            Os_TaskInternalResource_Release();
-            res = Os_ChainTask_Internal(param->p1.task);
-            Os_TaskInternalResource_Get();
+            res = Os_Syscall_ChainTask(param->p1.task);
             break;
         }
 
@@ -1003,6 +2444,74 @@ Os_StatusType Os_Syscall_Internal(Os_SyscallParamType* param)
             res = Os_GetAlarm_Internal(param->p1.alarm, param->p2.tick_ptr);
             break;
         }
+
+        case OSServiceId_SetRelAlarms: {
+            res = Os_SetRelAlarms_Internal(param->p2.alarm_ptr, param->p1.count);
+            break;
+        }
+#endif
+
+#ifdef OS_SCHEDULETABLE_COUNT
+        case OSServiceId_StartScheduleTableRel: {
+            res = Os_StartScheduleTableRel_Internal(param->p1.table, param->p2.tick[0]);
+            break;
+        }
+
+        case OSServiceId_StartScheduleTableAbs: {
+            res = Os_StartScheduleTableAbs_Internal(param->p1.table, param->p2.tick[0]);
+            break;
+        }
+
+        case OSServiceId_StopScheduleTable: {
+            res = Os_StopScheduleTable_Internal(param->p1.table);
+            break;
+        }
+
+        case OSServiceId_NextScheduleTable: {
+            res = Os_NextScheduleTable_Internal(param->p1.table, param->p2.table);
+            break;
+        }
+
+        case OSServiceId_GetScheduleTableStatus: {
+            res = Os_GetScheduleTableStatus_Internal(param->p1.table, param->p2.status_ptr);
+            break;
+        }
+#endif
+
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC1) ||  (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) )
+        case OSServiceId_SetEvent: {
+            res = Os_SetEvent_Internal(param->p1.task, param->p2.mask);
+            break;
+        }
+
+        case OSServiceId_ClearEvent: {
+            res = Os_ClearEvent_Internal(param->p2.mask);
+            break;
+        }
+
+        case OSServiceId_GetEvent: {
+            res = Os_GetEvent_Internal(param->p1.task, param->p2.mask_ptr);
+            break;
+        }
+
+        case OSServiceId_WaitEvent: {
+            res = Os_Syscall_WaitEvent(param->p2.mask);
+            break;
+        }
+
+#ifdef OS_TASKGROUP_COUNT
+        case OSServiceId_SetEventGroup: {
+            res = Os_SetEventGroup_Internal(param->p1.group, param->p2.mask);
+            break;
+        }
+#endif
+
+#ifdef OS_ALARM_COUNT
+        case OSServiceId_WaitEventTimeout: {
+            res = Os_Syscall_WaitEventTimeout(param->p1.mask, param->p2.tick[0]);
+            break;
+        }
+#endif
 #endif
 
 #ifdef OS_COUNTER_COUNT
@@ -1010,6 +2519,11 @@ Os_StatusType Os_Syscall_Internal(Os_SyscallParamType* param)
             res = Os_IncrementCounter_Internal(param->p1.counter);
             break;
         }
+
+        case OSServiceId_CounterAdvance: {
+            res = Os_AdvanceCounter_Internal(param->p1.counter, param->p2.tick[0]);
+            break;
+        }
 #endif
 
         case OSServiceId_Shutdown: {
@@ -1022,9 +2536,258 @@ Os_StatusType Os_Syscall_Internal(Os_SyscallParamType* param)
             break;
     }
 
+    (void)Os_Dispatch();
+    return res;
+}
+
+#if(OS_SYSCALL_DIRECT_ENABLE)
+
+static Os_StatusType Os_SyscallDirect_None(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a0; (void)a1; (void)a2;
+    return E_NOT_OK;
+}
+
+static Os_StatusType Os_SyscallDirect_Schedule(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a0; (void)a1; (void)a2;
+    return Os_Syscall_Schedule();
+}
+
+static Os_StatusType Os_SyscallDirect_TerminateTask(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a0; (void)a1; (void)a2;
+    return Os_Syscall_TerminateTask();
+}
+
+static Os_StatusType Os_SyscallDirect_ActivateTask(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a1; (void)a2;
+    return Os_ActivateTask_Internal((Os_TaskType)a0);
+}
+
+static Os_StatusType Os_SyscallDirect_GetResource(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a1; (void)a2;
+    return Os_GetResource_Internal((Os_ResourceType)a0);
+}
+
+static Os_StatusType Os_SyscallDirect_ReleaseResource(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a1; (void)a2;
+    return Os_ReleaseResource_Internal((Os_ResourceType)a0);
+}
+
+#ifdef OS_ALARM_COUNT
+static Os_StatusType Os_SyscallDirect_SetRelAlarm(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    return Os_SetRelAlarm_Internal((Os_AlarmType)a0, (Os_TickType)a1, (Os_TickType)a2);
+}
+
+static Os_StatusType Os_SyscallDirect_SetAbsAlarm(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    return Os_SetAbsAlarm_Internal((Os_AlarmType)a0, (Os_TickType)a1, (Os_TickType)a2);
+}
+
+static Os_StatusType Os_SyscallDirect_CancelAlarm(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a1; (void)a2;
+    return Os_CancelAlarm_Internal((Os_AlarmType)a0);
+}
+
+static Os_StatusType Os_SyscallDirect_GetAlarm(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a2;
+    return Os_GetAlarm_Internal((Os_AlarmType)a0, (Os_TickType*)a1);
+}
+
+static Os_StatusType Os_SyscallDirect_SetRelAlarms(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a2;
+    return Os_SetRelAlarms_Internal((const Os_AlarmSetType*)a0, (Os_AlarmType)a1);
+}
+#else
+#define Os_SyscallDirect_SetRelAlarm  Os_SyscallDirect_None
+#define Os_SyscallDirect_SetAbsAlarm  Os_SyscallDirect_None
+#define Os_SyscallDirect_CancelAlarm  Os_SyscallDirect_None
+#define Os_SyscallDirect_GetAlarm     Os_SyscallDirect_None
+#define Os_SyscallDirect_SetRelAlarms Os_SyscallDirect_None
+#endif
+
+#ifdef OS_SCHEDULETABLE_COUNT
+static Os_StatusType Os_SyscallDirect_StartScheduleTableRel(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a2;
+    return Os_StartScheduleTableRel_Internal((Os_ScheduleTableType)a0, (Os_TickType)a1);
+}
+
+static Os_StatusType Os_SyscallDirect_StartScheduleTableAbs(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a2;
+    return Os_StartScheduleTableAbs_Internal((Os_ScheduleTableType)a0, (Os_TickType)a1);
+}
+
+static Os_StatusType Os_SyscallDirect_StopScheduleTable(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a1; (void)a2;
+    return Os_StopScheduleTable_Internal((Os_ScheduleTableType)a0);
+}
+
+static Os_StatusType Os_SyscallDirect_NextScheduleTable(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a2;
+    return Os_NextScheduleTable_Internal((Os_ScheduleTableType)a0, (Os_ScheduleTableType)a1);
+}
+
+static Os_StatusType Os_SyscallDirect_GetScheduleTableStatus(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a2;
+    return Os_GetScheduleTableStatus_Internal((Os_ScheduleTableType)a0, (Os_ScheduleTableStatusType*)a1);
+}
+#else
+#define Os_SyscallDirect_StartScheduleTableRel  Os_SyscallDirect_None
+#define Os_SyscallDirect_StartScheduleTableAbs  Os_SyscallDirect_None
+#define Os_SyscallDirect_StopScheduleTable      Os_SyscallDirect_None
+#define Os_SyscallDirect_NextScheduleTable      Os_SyscallDirect_None
+#define Os_SyscallDirect_GetScheduleTableStatus Os_SyscallDirect_None
+#endif
+
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC1) ||  (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) )
+static Os_StatusType Os_SyscallDirect_SetEvent(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a2;
+    return Os_SetEvent_Internal((Os_TaskType)a0, (Os_EventMaskType)a1);
+}
+
+static Os_StatusType Os_SyscallDirect_ClearEvent(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a0; (void)a2;
+    return Os_ClearEvent_Internal((Os_EventMaskType)a1);
+}
+
+static Os_StatusType Os_SyscallDirect_GetEvent(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a2;
+    return Os_GetEvent_Internal((Os_TaskType)a0, (Os_EventMaskType*)a1);
+}
+
+static Os_StatusType Os_SyscallDirect_WaitEvent(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a0; (void)a2;
+    return Os_Syscall_WaitEvent((Os_EventMaskType)a1);
+}
+#else
+#define Os_SyscallDirect_SetEvent   Os_SyscallDirect_None
+#define Os_SyscallDirect_ClearEvent Os_SyscallDirect_None
+#define Os_SyscallDirect_GetEvent   Os_SyscallDirect_None
+#define Os_SyscallDirect_WaitEvent  Os_SyscallDirect_None
+#endif
+
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC1) ||  (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) ) && defined(OS_ALARM_COUNT)
+static Os_StatusType Os_SyscallDirect_WaitEventTimeout(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a2;
+    return Os_Syscall_WaitEventTimeout((Os_EventMaskType)a0, (Os_TickType)a1);
+}
+#else
+#define Os_SyscallDirect_WaitEventTimeout Os_SyscallDirect_None
+#endif
+
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC1) ||  (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) ) && defined(OS_TASKGROUP_COUNT)
+static Os_StatusType Os_SyscallDirect_SetEventGroup(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a2;
+    return Os_SetEventGroup_Internal((Os_TaskGroupType)a0, (Os_EventMaskType)a1);
+}
+#else
+#define Os_SyscallDirect_SetEventGroup Os_SyscallDirect_None
+#endif
+
+static Os_StatusType Os_SyscallDirect_ChainTask(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a1; (void)a2;
+    return Os_Syscall_ChainTask((Os_TaskType)a0);
+}
+
+static Os_StatusType Os_SyscallDirect_CounterIncrement(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a1; (void)a2;
+    return Os_IncrementCounter_Internal((Os_CounterType)a0);
+}
+
+static Os_StatusType Os_SyscallDirect_CounterAdvance(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a2;
+    return Os_AdvanceCounter_Internal((Os_CounterType)a0, (Os_TickType)a1);
+}
+
+static Os_StatusType Os_SyscallDirect_Shutdown(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    (void)a0; (void)a1; (void)a2;
+    return Os_Shutdown_Internal();
+}
+
+/**
+ * @brief Typed kernel entry points, indexed by Os_ServiceIdType
+ */
+static const Os_SyscallDirectType Os_SyscallTable[OSServiceId_Count] = {
+    Os_SyscallDirect_None,              /* OSServiceId_None */
+    Os_SyscallDirect_Schedule,          /* OSServiceId_Schedule */
+    Os_SyscallDirect_TerminateTask,     /* OSServiceId_TerminateTask */
+    Os_SyscallDirect_ActivateTask,      /* OSServiceId_ActivateTask */
+    Os_SyscallDirect_GetResource,       /* OSServiceId_GetResource */
+    Os_SyscallDirect_ReleaseResource,   /* OSServiceId_ReleaseResource */
+    Os_SyscallDirect_SetRelAlarm,       /* OSServiceId_SetRelAlarm */
+    Os_SyscallDirect_SetAbsAlarm,       /* OSServiceId_SetAbsAlarm */
+    Os_SyscallDirect_CancelAlarm,       /* OSServiceId_CancelAlarm */
+    Os_SyscallDirect_GetAlarm,          /* OSServiceId_GetAlarm */
+    Os_SyscallDirect_ChainTask,         /* OSServiceId_ChainTask */
+    Os_SyscallDirect_CounterIncrement,  /* OSServiceId_CounterIncrement */
+    Os_SyscallDirect_Shutdown,          /* OSServiceId_Shutdown */
+    Os_SyscallDirect_CounterAdvance,    /* OSServiceId_CounterAdvance */
+    Os_SyscallDirect_SetRelAlarms,      /* OSServiceId_SetRelAlarms */
+    Os_SyscallDirect_StartScheduleTableRel,  /* OSServiceId_StartScheduleTableRel */
+    Os_SyscallDirect_StartScheduleTableAbs,  /* OSServiceId_StartScheduleTableAbs */
+    Os_SyscallDirect_StopScheduleTable,      /* OSServiceId_StopScheduleTable */
+    Os_SyscallDirect_NextScheduleTable,      /* OSServiceId_NextScheduleTable */
+    Os_SyscallDirect_GetScheduleTableStatus, /* OSServiceId_GetScheduleTableStatus */
+    Os_SyscallDirect_SetEvent,          /* OSServiceId_SetEvent */
+    Os_SyscallDirect_ClearEvent,        /* OSServiceId_ClearEvent */
+    Os_SyscallDirect_GetEvent,          /* OSServiceId_GetEvent */
+    Os_SyscallDirect_WaitEvent,         /* OSServiceId_WaitEvent */
+    Os_SyscallDirect_WaitEventTimeout,  /* OSServiceId_WaitEventTimeout */
+    Os_SyscallDirect_SetEventGroup,     /* OSServiceId_SetEventGroup */
+};
+
+/**
+ * @brief Kernel side of the direct syscall abi
+ * @param service service to perform
+ * @param a0 first argument of service
+ * @param a1 second argument of service
+ * @param a2 third argument of service
+ * @return status of service
+ *
+ * Same as Os_Syscall_Internal, but arguments stay in registers and the
+ * service is reached through Os_SyscallTable instead of a switch.
+ */
+Os_StatusType Os_Syscall_Direct(Os_ServiceIdType service, Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    Os_StatusType res;
+    if (Os_Unlikely(Os_CallContext == OS_CONTEXT_ALARMCALLBACK)) {
+        return Os_Syscall_CallLevel(service);
+    }
+
+    if (Os_Likely((uint16)service < (uint16)OSServiceId_Count)) {
+        res = Os_SyscallTable[service](a0, a1, a2);
+    } else {
+        res = E_NOT_OK;
+    }
+    (void)Os_Dispatch();
     return res;
 }
 
+#endif /* OS_SYSCALL_DIRECT_ENABLE */
+
 /**
  * @brief Initializes OS internal structures with given config
  * @param config Configuration to use
@@ -1035,19 +2798,38 @@ void Os_Init(const Os_ConfigType* config)
     Os_ResourceType res;
     Os_AlarmType    alarm;
     Os_CounterType  counter;
-    uint_least8_t prio;
+    Os_PriorityType prio;
+#ifdef OS_SCHEDULETABLE_COUNT
+    Os_ScheduleTableType table;
+    uint16               point;
+#endif
 
     Os_TaskConfigs     = *config->tasks;
     Os_ResourceConfigs = *config->resources;
     Os_AlarmConfigs    = *config->alarms;
+    Os_CounterConfigs  = config->counters ? *config->counters : NULL;
+#ifdef OS_SCHEDULETABLE_COUNT
+    Os_ScheduleTableConfigs = *config->scheduletables;
+#endif
+#ifdef OS_TASKGROUP_COUNT
+    Os_TaskGroupConfigs     = *config->taskgroups;
+#endif
+#ifdef OS_ISR_COUNT
+    Os_IsrConfigs           = *config->isrs;
+#endif
     Os_CallContext     = OS_CONTEXT_NONE;
+    Os_IsrNesting      = 0u;
     Os_ActiveTask      = OS_INVALID_TASK;
     Os_Continue        = TRUE;
+    Os_DispatchPending = FALSE;
 
     memset(&Os_TaskControls    , 0u, sizeof(Os_TaskControls));
     memset(&Os_ResourceControls, 0u, sizeof(Os_ResourceControls));
+    memset(&Os_TaskReadyMask   , 0u, sizeof(Os_TaskReadyMask));
+    Os_TaskReadyGroup  = 0u;
+    Os_TaskReadyHighest = -1;
 
-    for (prio = 0u; prio < OS_PRIO_COUNT; ++prio) {
+    for (prio = 0; prio < OS_PRIO_COUNT; ++prio) {
         Os_ReadyListInit(&Os_TaskReady[prio]);
     }
 
@@ -1063,12 +2845,21 @@ void Os_Init(const Os_ConfigType* config)
 
 #ifdef OS_ALARM_COUNT
     /* initialize alarms */
-    for (alarm  = 0u; alarm  < OS_ALARM_COUNT; ++alarm) {
+    for (alarm  = 0u; alarm  < OS_ALARM_QUEUE_COUNT; ++alarm) {
         Os_AlarmInit(alarm);
     }
 #endif
 
+#ifdef OS_SCHEDULETABLE_COUNT
+    /* initialize schedule tables */
+    for (table = 0u; table < OS_SCHEDULETABLE_COUNT; ++table) {
+        Os_ScheduleTableInit(table);
+    }
+#endif
+
 #ifdef OS_COUNTER_COUNT
+    /* initialize counters */
+    Os_CounterQueueLayout();
     for (counter = 0u; counter < OS_COUNTER_COUNT; ++counter) {
         Os_CounterInit(counter);
     }
@@ -1077,12 +2868,25 @@ void Os_Init(const Os_ConfigType* config)
     /* run arch init */
     Os_Arch_Init();
 
+#ifdef OS_SCHEDULETABLE_COUNT
+    /* check schedule table config, the expiry code relies on it */
+    for (table = 0u; table < OS_SCHEDULETABLE_COUNT; ++table) {
+        OS_CHECK_EXT(Os_ScheduleTableConfigs[table].count > 0u, E_OS_VALUE);
+        for (point = 1u; point < Os_ScheduleTableConfigs[table].count; ++point) {
+            OS_CHECK_EXT(Os_ScheduleTableConfigs[table].points[point - 1u].offset
+                       < Os_ScheduleTableConfigs[table].points[point].offset, E_OS_VALUE);
+        }
+        OS_CHECK_EXT(Os_ScheduleTableConfigs[table].points[point - 1u].offset
+                   < Os_ScheduleTableConfigs[table].duration, E_OS_VALUE);
+    }
+#endif
+
     /* make sure any activated task is in ready list */
     for (task = 0u; task < OS_TASK_COUNT; ++task) {
 
         /* check some task config */
         Os_ResourceType res = Os_TaskConfigs[task].resource;
-        if (res != OS_INVALID_TASK) {
+        if (res != OS_INVALID_RESOURCE) {
             OS_CHECK_EXT(Os_TaskConfigs[task].priority <= Os_ResourceConfigs[res].priority, E_OS_RESOURCE);
         }
 
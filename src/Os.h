@@ -57,6 +57,33 @@
 #define OS_COUNTER_SYSTEM (Os_CounterType)0u
 #endif
 
+#ifndef OS_ALARM_WHEEL_ENABLE
+#define OS_ALARM_WHEEL_ENABLE 0
+#endif
+
+#ifndef OS_ALARM_HEAP_ARITY
+#define OS_ALARM_HEAP_ARITY 4u
+#endif
+
+/**
+ * @brief Number of alarms queued on counters
+ *
+ * Each schedule table is driven by an alarm of its own, numbered after the
+ * configured alarms. With extended tasks, each task then has an alarm for
+ * the timeout of Os_WaitEventTimeout, queued on OS_COUNTER_SYSTEM.
+ */
+#ifdef OS_SCHEDULETABLE_COUNT
+#define OS_ALARM_TIMEOUT_FIRST (OS_ALARM_COUNT + OS_SCHEDULETABLE_COUNT)
+#else
+#define OS_ALARM_TIMEOUT_FIRST (OS_ALARM_COUNT)
+#endif
+
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC1) ||  (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) )
+#define OS_ALARM_QUEUE_COUNT (OS_ALARM_TIMEOUT_FIRST + OS_TASK_COUNT)
+#else
+#define OS_ALARM_QUEUE_COUNT (OS_ALARM_TIMEOUT_FIRST)
+#endif
+
 #ifdef __GNUC__
 #define Os_Unlikely(x)  __builtin_expect((x),0)
 #define Os_Likely(x)    __builtin_expect((x),1)
@@ -78,6 +105,9 @@ typedef struct Os_TaskConfigType {
     uint8            activation;  /**< @brief maximum number of activations allowed */
 #endif
     Os_ResourceType  resource;    /**< @brief internal resource of task, can be Os_TaskIdNone */
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC1) ||  (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) )
+    boolean          extended;    /**< @brief task may wait for events */
+#endif
 } Os_TaskConfigType;
 
 /**
@@ -91,8 +121,29 @@ typedef struct Os_TaskControlType {
     Os_TaskType      next;        /**< @brief next task in the same ready list */
     Os_ResourceType  resource;    /**< @brief last taken resource for task (rest is linked list */
     Os_PriorityType  priority;
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC1) ||  (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) )
+    Os_EventMaskType events;      /**< @brief events set for task */
+    Os_EventMaskType wait;        /**< @brief events the task waits for */
+    boolean          timeout;     /**< @brief last wait ended by its timeout */
+#endif
 } Os_TaskControlType;
 
+/**
+ * @brief Structure holding configuration setup for each task group
+ */
+typedef struct Os_TaskGroupConfigType {
+    const Os_TaskType* tasks;     /**< @brief member tasks, all extended */
+    Os_TaskType        count;     /**< @brief number of member tasks */
+} Os_TaskGroupConfigType;
+
+/**
+ * @brief Structure holding configuration setup for each category 2 interrupt
+ */
+typedef struct Os_IsrConfigType {
+    void (*entry)(void);          /**< @brief handler, may use services allowed in ISR2 context */
+    uint8 priority;               /**< @brief interrupt priority, higher nests into lower, for arches with an interrupt controller */
+} Os_IsrConfigType;
+
 /**
  * @brief Structure holding configuration setup for each resource
  */
@@ -110,19 +161,152 @@ typedef struct Os_ResourceControlType {
 #endif
 } Os_ResourceControlType;
 
+/**
+ * @brief Action performed when an alarm expires
+ */
+typedef enum Os_AlarmActionEnum {
+    OS_ALARM_ACTION_ACTIVATETASK = 0, /**< @brief activate the configured task */
+    OS_ALARM_ACTION_ALARMCALLBACK,    /**< @brief call the configured callback, see Os_AlarmCallbackType */
+    OS_ALARM_ACTION_SETEVENT          /**< @brief set the configured event of the configured extended task, ECC only */
+} Os_AlarmActionEnum;
+
+/**
+ * @brief Alarm callback
+ *
+ * Called directly from the kernel while it advances the counter of the
+ * alarm, in OS_CONTEXT_ALARMCALLBACK with interrupts suspended and without
+ * any task switch. No kernel service may be called from it, each one is
+ * refused with E_OS_CALLEVEL. Callbacks are meant to set a flag or kick a
+ * driver and must be short, they delay every other alarm of the counter.
+ */
+typedef void (*Os_AlarmCallbackType)(void);
+
 /**
  * @brief Structure holding configuration setup for each alarm
  */
 typedef struct Os_AlarmConfigType {
-    Os_TaskType     task;         /**< @brief task to activate */
-    Os_CounterType  counter;      /**< @brief counter driving this alarm */
+    Os_TaskType          task;     /**< @brief task to activate */
+    Os_CounterType       counter;  /**< @brief counter driving this alarm */
+    Os_AlarmActionEnum   action;   /**< @brief what to do when the alarm expires */
+    Os_AlarmCallbackType callback; /**< @brief callback of a OS_ALARM_ACTION_ALARMCALLBACK alarm */
+    Os_EventMaskType     event;    /**< @brief events set by a OS_ALARM_ACTION_SETEVENT alarm */
 } Os_AlarmConfigType;
 
-typedef uint8 Os_AlarmQueueIndexType;
+/**
+ * @brief One entry of a batch of alarms set by Os_SetRelAlarms
+ */
+typedef struct Os_AlarmSetType {
+    Os_AlarmType    alarm;        /**< @brief alarm to set */
+    Os_TickType     increment;    /**< @brief relative value in ticks */
+    Os_TickType     cycle;        /**< @brief cycle value, zero for single alarms */
+} Os_AlarmSetType;
+
+typedef Os_AlarmType Os_AlarmQueueIndexType; /**< index into a counter alarm queue, same width as alarms */
+
+/**
+ * @brief Expiry point of a schedule table
+ */
+typedef struct Os_ScheduleTableExpiryType {
+    Os_TickType          offset;   /**< @brief ticks from the start of the table, strictly increasing along the table */
+    const Os_TaskType*   tasks;    /**< @brief tasks to activate */
+    Os_TaskType          count;    /**< @brief number of tasks to activate */
+} Os_ScheduleTableExpiryType;
+
+/**
+ * @brief Structure holding configuration setup for each schedule table
+ */
+typedef struct Os_ScheduleTableConfigType {
+    Os_CounterType                    counter;   /**< @brief counter driving this table */
+    Os_TickType                       duration;  /**< @brief length of one round, non zero and not before the last offset */
+    boolean                           repeating; /**< @brief start over after the final delay instead of stopping */
+    const Os_ScheduleTableExpiryType* points;    /**< @brief expiry points */
+    uint16                            count;     /**< @brief number of expiry points, at least one */
+} Os_ScheduleTableConfigType;
+
+/**
+ * @brief Structure holding active state information for each schedule table
+ */
+typedef struct Os_ScheduleTableControlType {
+    Os_ScheduleTableStatusType state;     /**< @brief current state */
+    uint16                     point;     /**< @brief next expiry point, count during the final delay */
+    Os_ScheduleTableType       next;      /**< @brief table to start when this one ends */
+} Os_ScheduleTableControlType;
+
+/**
+ * @brief Structure holding active state information for each alarm
+ */
+typedef struct Os_AlarmControlType {
+    Os_TickType            ticks;  /**< @brief counter value at which alarm expires */
+    Os_TickType            cycle;  /**< @brief number of ticks in each cycle, zero for single alarms */
+    Os_AlarmQueueIndexType index;  /**< @brief heap or wheel slot of alarm while queued */
+    boolean                queued; /**< @brief is this alarm active */
+#if(OS_ALARM_WHEEL_ENABLE)
+    Os_AlarmType           next;   /**< @brief next alarm in the same wheel slot */
+    Os_AlarmType           prev;   /**< @brief previous alarm in the same wheel slot */
+#endif
+} Os_AlarmControlType;
+
+/**
+ * @brief Entry of the alarm heap
+ *
+ * The expiry tick is kept next to the alarm, so ordering the heap never
+ * has to look up the alarm controls.
+ */
+typedef struct Os_AlarmQueueEntryType {
+    Os_TickType            tick;   /**< @brief counter value at which alarm expires */
+    Os_AlarmType           alarm;  /**< @brief queued alarm */
+} Os_AlarmQueueEntryType;
+
+/**
+ * @brief Alarm queue backends a counter can use
+ */
+typedef enum Os_CounterQueueEnum {
+    OS_COUNTER_QUEUE_HEAP = 0,    /**< @brief binary heap, O(log n) arm, cancel and expiry */
+    OS_COUNTER_QUEUE_WHEEL        /**< @brief hierarchical timing wheel, O(1) arm, cancel and expiry, needs OS_ALARM_WHEEL_ENABLE */
+} Os_CounterQueueEnum;
+
+/**
+ * @brief Sources that can advance a counter
+ */
+typedef enum Os_CounterSourceEnum {
+    OS_COUNTER_SOURCE_DEFAULT = 0, /**< @brief arch timer at OS_TICK_US for OS_COUNTER_SYSTEM, software for all other counters */
+    OS_COUNTER_SOURCE_SOFTWARE,    /**< @brief advanced by IncrementCounter, AdvanceCounter or an application isr calling Os_CounterIsr */
+    OS_COUNTER_SOURCE_TIMER        /**< @brief advanced each period by an arch timer of its own */
+} Os_CounterSourceEnum;
+
+/**
+ * @brief Structure holding configuration setup for each counter
+ *
+ * Without a counter configuration, or with the source left at its default,
+ * the system counter is driven by the arch timer at OS_TICK_US and all
+ * other counters are software counters.
+ */
+typedef struct Os_CounterConfigType {
+    Os_CounterQueueEnum  queue;   /**< @brief backend used to queue alarms driven by this counter */
+    Os_CounterSourceEnum source;  /**< @brief what advances this counter */
+    uint32               period;  /**< @brief tick period in microseconds of a timer source, 0 for OS_TICK_US */
+} Os_CounterConfigType;
+
+#if(OS_ALARM_WHEEL_ENABLE)
+/**
+ * @brief Timing wheel geometry
+ *
+ * Each level holds one slot per value of a OS_ALARM_WHEEL_BITS wide digit
+ * of the tick value, enough levels are used to cover the full tick range.
+ */
+#define OS_ALARM_WHEEL_BITS   4u
+#define OS_ALARM_WHEEL_SLOTS  (1u << OS_ALARM_WHEEL_BITS)
+#define OS_ALARM_WHEEL_LEVELS ((sizeof(Os_TickType) * 8u) / OS_ALARM_WHEEL_BITS)
+#endif
 
 typedef struct Os_CounterControlType {
-    Os_TickType     ticks;
-    Os_AlarmType    queue[OS_ALARM_COUNT+1]; /**< 1 based binary heap, [0] contain number of active entries */
+    Os_TickType            ticks;
+    Os_AlarmQueueIndexType count;                 /**< number of entries in queue */
+    Os_AlarmQueueIndexType size;                  /**< capacity of queue, number of alarms driven by this counter */
+    Os_AlarmQueueEntryType* queue;                /**< 0 based OS_ALARM_HEAP_ARITY-ary heap, slice of Os_AlarmQueuePool */
+#if(OS_ALARM_WHEEL_ENABLE)
+    Os_AlarmType           wheel[OS_ALARM_WHEEL_LEVELS * OS_ALARM_WHEEL_SLOTS]; /**< heads of alarm lists, level major */
+#endif
 } Os_CounterControlType;
 
 /**
@@ -133,6 +317,18 @@ typedef struct Os_ReadyListType {
     Os_TaskType tail;             /**< @brief pointer to the last ready task */
 } Os_ReadyListType;
 
+/**
+ * @brief Word of the ready bitmap
+ *
+ * The bitmap is two level, each bit of Os_TaskReadyGroup marks a non
+ * empty word in Os_TaskReadyMask, where each bit in turn marks a non
+ * empty ready list. This limits OS_PRIO_COUNT to 32*32 priorities.
+ */
+typedef uint32 Os_ReadyMaskType;
+
+#define OS_READYMASK_BITS  32u
+#define OS_READYMASK_COUNT ((OS_PRIO_COUNT + OS_READYMASK_BITS - 1u) / OS_READYMASK_BITS)
+
 /**
  * @brief Main configuration structure of Os
  */
@@ -141,6 +337,16 @@ typedef struct Os_ConfigType {
     const Os_ResourceConfigType (*resources)[OS_RES_COUNT]; /**< @brief pointer to an array of resource configurations */
 #ifdef OS_ALARM_COUNT
     const Os_AlarmConfigType    (*alarms)[OS_ALARM_COUNT];  /**< @brief pointer to an array of alarm configurations */
+#endif
+    const Os_CounterConfigType  (*counters)[OS_COUNTER_COUNT]; /**< @brief pointer to an array of counter configurations, NULL for defaults */
+#ifdef OS_SCHEDULETABLE_COUNT
+    const Os_ScheduleTableConfigType (*scheduletables)[OS_SCHEDULETABLE_COUNT]; /**< @brief pointer to an array of schedule table configurations */
+#endif
+#ifdef OS_TASKGROUP_COUNT
+    const Os_TaskGroupConfigType (*taskgroups)[OS_TASKGROUP_COUNT]; /**< @brief pointer to an array of task group configurations */
+#endif
+#ifdef OS_ISR_COUNT
+    const Os_IsrConfigType (*isrs)[OS_ISR_COUNT]; /**< @brief pointer to an array of category 2 interrupt configurations */
 #endif
 } Os_ConfigType;
 
@@ -152,15 +358,24 @@ typedef struct Os_ErrorType {
 #if(OS_ERROR_EXT_ENABLE)
     uint16         line;
 #endif
-    uint16         params[3];
+    Os_TickType    params[3];     /**< service arguments, wide enough for identifiers and ticks */
 } Os_ErrorType;
 
 extern Os_ErrorType                    Os_Error;
 extern Os_TaskControlType              Os_TaskControls        [OS_TASK_COUNT];
 extern Os_ReadyListType                Os_TaskReady           [OS_PRIO_COUNT];
+extern Os_ReadyMaskType                Os_TaskReadyMask       [OS_READYMASK_COUNT];
+extern Os_ReadyMaskType                Os_TaskReadyGroup;
+extern volatile Os_PriorityType        Os_TaskReadyHighest;
 extern Os_TaskType                     Os_ActiveTask;
 extern Os_ContextType                  Os_CallContext;
+extern uint8                           Os_IsrNesting;
+extern volatile boolean                Os_Continue;
 extern const Os_TaskConfigType *       Os_TaskConfigs;
+extern const Os_CounterConfigType *    Os_CounterConfigs;
+#ifdef OS_ISR_COUNT
+extern const Os_IsrConfigType *        Os_IsrConfigs;
+#endif
 
 void       Os_TaskInternalResource_Release(void);
 void       Os_TaskInternalResource_Get(void);
@@ -168,6 +383,10 @@ void       Os_TaskInternalResource_Get(void);
 void       Os_Init(const Os_ConfigType* config);
 void       Os_Start(void);
 void       Os_Isr(void);
+void       Os_CounterIsr(Os_CounterType counter, Os_TickType ticks);
+#ifdef OS_ISR_COUNT
+void       Os_Isr2(Os_IsrType isr);
+#endif
 
 
 typedef enum Os_ServiceIdType {
@@ -184,6 +403,20 @@ typedef enum Os_ServiceIdType {
     OSServiceId_ChainTask,
     OSServiceId_CounterIncrement,
     OSServiceId_Shutdown,
+    OSServiceId_CounterAdvance,
+    OSServiceId_SetRelAlarms,
+    OSServiceId_StartScheduleTableRel,
+    OSServiceId_StartScheduleTableAbs,
+    OSServiceId_StopScheduleTable,
+    OSServiceId_NextScheduleTable,
+    OSServiceId_GetScheduleTableStatus,
+    OSServiceId_SetEvent,
+    OSServiceId_ClearEvent,
+    OSServiceId_GetEvent,
+    OSServiceId_WaitEvent,
+    OSServiceId_WaitEventTimeout,
+    OSServiceId_SetEventGroup,
+    OSServiceId_Count,
 } Os_ServiceIdType;
 
 typedef struct Os_SyscallParamType {
@@ -193,121 +426,419 @@ typedef struct Os_SyscallParamType {
         Os_AlarmType    alarm;
         Os_CounterType  counter;
         Os_ResourceType resource;
+        Os_AlarmType    count;
+        Os_ScheduleTableType table;
+        Os_EventMaskType mask;
+        Os_TaskGroupType group;
     } p1;
     union {
-        Os_TickType  tick[2];
-        Os_TickType* tick_ptr;
+        Os_TickType                 tick[2];
+        Os_TickType*                tick_ptr;
+        const Os_AlarmSetType*      alarm_ptr;
+        Os_ScheduleTableType        table;
+        Os_ScheduleTableStatusType* status_ptr;
+        Os_EventMaskType            mask;
+        Os_EventMaskType*           mask_ptr;
     } p2;
 } Os_SyscallParamType;
 
 extern Os_StatusType Os_Arch_Syscall(Os_SyscallParamType* param);
 
-/** @copydoc Os_Schedule_Internal */
+/**
+ * @brief Direct syscall abi
+ *
+ * Instead of packing a Os_SyscallParamType on the stack, each service
+ * is passed as service id and up to three register sized arguments to
+ * Os_Arch_SyscallDirect, which enters the kernel through Os_Syscall_Direct.
+ * Arches that can pass arguments in registers into the kernel define
+ * OS_ARCH_SYSCALL_DIRECT to have this used by default, else it is
+ * enabled by defining OS_SYSCALL_DIRECT_ENABLE to 1.
+ */
+#ifndef OS_SYSCALL_DIRECT_ENABLE
+#ifdef OS_ARCH_SYSCALL_DIRECT
+#define OS_SYSCALL_DIRECT_ENABLE OS_ARCH_SYSCALL_DIRECT
+#else
+#define OS_SYSCALL_DIRECT_ENABLE 0
+#endif
+#endif
+
+#if(OS_SYSCALL_DIRECT_ENABLE)
+typedef uintptr_t Os_SyscallArgType;
+typedef Os_StatusType (*Os_SyscallDirectType)(Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2);
+
+extern Os_StatusType Os_Arch_SyscallDirect(Os_ServiceIdType service, Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2);
+Os_StatusType        Os_Syscall_Direct    (Os_ServiceIdType service, Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2);
+
+#define OS_SYSCALL_DIRECT(service, a0, a1, a2) \
+    Os_Arch_SyscallDirect((service), (Os_SyscallArgType)(a0), (Os_SyscallArgType)(a1), (Os_SyscallArgType)(a2))
+#endif
+
+/**
+ * @copydoc Os_Schedule_Internal
+ *
+ * The published highest ready priority is compared against the base
+ * priority of the calling task, if nothing above it is ready the call
+ * can not cause a task switch and returns without trapping into the kernel.
+ * Only tasks take that shortcut, the kernel refuses calls from interrupts
+ * and alarm callbacks.
+ */
 static __inline Os_StatusType Os_Schedule(void)
 {
-    Os_SyscallParamType param;
-    param.service = OSServiceId_Schedule;
-    return Os_Arch_Syscall(&param);
+    Os_StatusType res;
+    if ((Os_CallContext == OS_CONTEXT_TASK)
+    &&  (Os_IsrNesting  == 0u)
+    &&  (Os_TaskReadyHighest <= Os_TaskConfigs[Os_ActiveTask].priority)) {
+        res = E_OK;
+    } else {
+#if(OS_SYSCALL_DIRECT_ENABLE)
+        res = OS_SYSCALL_DIRECT(OSServiceId_Schedule, 0u, 0u, 0u);
+#else
+        Os_SyscallParamType param;
+        param.service = OSServiceId_Schedule;
+        res = Os_Arch_Syscall(&param);
+#endif
+    }
+    return res;
 }
 
 /** @copydoc Os_TerminateTask_Internal */
 static __inline Os_StatusType Os_TerminateTask(void)
 {
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_TerminateTask, 0u, 0u, 0u);
+#else
     Os_SyscallParamType param;
     param.service = OSServiceId_TerminateTask;
     return Os_Arch_Syscall(&param);
+#endif
 }
 
 /** @copydoc Os_ActivateTask_Internal */
 static __inline Os_StatusType Os_ActivateTask(Os_TaskType task)
 {
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_ActivateTask, task, 0u, 0u);
+#else
     Os_SyscallParamType param;
     param.service = OSServiceId_ActivateTask;
     param.p1.task = task;
     return Os_Arch_Syscall(&param);
+#endif
 }
 
 /** @copydoc Os_ChainTask_Internal */
 static __inline Os_StatusType Os_ChainTask(Os_TaskType task)
 {
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_ChainTask, task, 0u, 0u);
+#else
     Os_SyscallParamType param;
     param.service = OSServiceId_ChainTask;
     param.p1.task = task;
     return Os_Arch_Syscall(&param);
+#endif
 }
 
 /** @copydoc Os_GetResource_Internal */
 static __inline Os_StatusType Os_GetResource(Os_ResourceType res)
 {
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_GetResource, res, 0u, 0u);
+#else
     Os_SyscallParamType param;
     param.service     = OSServiceId_GetResource;
     param.p1.resource = res;
     return Os_Arch_Syscall(&param);
+#endif
 }
 
 /** @copydoc Os_ReleaseResource_Internal */
 static __inline Os_StatusType Os_ReleaseResource(Os_ResourceType res)
 {
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_ReleaseResource, res, 0u, 0u);
+#else
     Os_SyscallParamType param;
     param.service     = OSServiceId_ReleaseResource;
     param.p1.resource = res;
     return Os_Arch_Syscall(&param);
+#endif
 }
 
 /** @copydoc Os_SetRelAlarm_Internal */
 static __inline Os_StatusType Os_SetRelAlarm(Os_AlarmType alarm, Os_TickType increment, Os_TickType cycle)
 {
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_SetRelAlarm, alarm, increment, cycle);
+#else
     Os_SyscallParamType param;
     param.service    = OSServiceId_SetRelAlarm;
     param.p1.alarm   = alarm;
     param.p2.tick[0] = increment;
     param.p2.tick[1] = cycle;
     return Os_Arch_Syscall(&param);
+#endif
 }
 
 /** @copydoc Os_SetAbsAlarm_Internal */
 static __inline Os_StatusType Os_SetAbsAlarm(Os_AlarmType alarm, Os_TickType start    , Os_TickType cycle)
 {
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_SetAbsAlarm, alarm, start, cycle);
+#else
     Os_SyscallParamType param;
     param.service    = OSServiceId_SetAbsAlarm;
     param.p1.alarm   = alarm;
     param.p2.tick[0] = start;
     param.p2.tick[1] = cycle;
     return Os_Arch_Syscall(&param);
+#endif
 }
 
 /** @copydoc Os_CancelAlarm_Internal */
 static __inline Os_StatusType Os_CancelAlarm(Os_AlarmType alarm)
 {
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_CancelAlarm, alarm, 0u, 0u);
+#else
     Os_SyscallParamType param;
     param.service    = OSServiceId_CancelAlarm;
     param.p1.alarm   = alarm;
     return Os_Arch_Syscall(&param);
+#endif
 }
 
 /** @copydoc Os_GetAlarm_Internal */
 static __inline Os_StatusType Os_GetAlarm   (Os_AlarmType alarm, Os_TickType* tick)
 {
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_GetAlarm, alarm, tick, 0u);
+#else
     Os_SyscallParamType param;
     param.service     = OSServiceId_GetAlarm;
     param.p1.alarm    = alarm;
     param.p2.tick_ptr = tick;
     return Os_Arch_Syscall(&param);
+#endif
+}
+
+/** @copydoc Os_SetRelAlarms_Internal */
+static __inline Os_StatusType Os_SetRelAlarms(const Os_AlarmSetType* alarms, Os_AlarmType count)
+{
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_SetRelAlarms, alarms, count, 0u);
+#else
+    Os_SyscallParamType param;
+    param.service      = OSServiceId_SetRelAlarms;
+    param.p1.count     = count;
+    param.p2.alarm_ptr = alarms;
+    return Os_Arch_Syscall(&param);
+#endif
+}
+
+#ifdef OS_SCHEDULETABLE_COUNT
+/** @copydoc Os_StartScheduleTableRel_Internal */
+static __inline Os_StatusType Os_StartScheduleTableRel(Os_ScheduleTableType table, Os_TickType offset)
+{
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_StartScheduleTableRel, table, offset, 0u);
+#else
+    Os_SyscallParamType param;
+    param.service    = OSServiceId_StartScheduleTableRel;
+    param.p1.table   = table;
+    param.p2.tick[0] = offset;
+    return Os_Arch_Syscall(&param);
+#endif
+}
+
+/** @copydoc Os_StartScheduleTableAbs_Internal */
+static __inline Os_StatusType Os_StartScheduleTableAbs(Os_ScheduleTableType table, Os_TickType start)
+{
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_StartScheduleTableAbs, table, start, 0u);
+#else
+    Os_SyscallParamType param;
+    param.service    = OSServiceId_StartScheduleTableAbs;
+    param.p1.table   = table;
+    param.p2.tick[0] = start;
+    return Os_Arch_Syscall(&param);
+#endif
+}
+
+/** @copydoc Os_StopScheduleTable_Internal */
+static __inline Os_StatusType Os_StopScheduleTable(Os_ScheduleTableType table)
+{
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_StopScheduleTable, table, 0u, 0u);
+#else
+    Os_SyscallParamType param;
+    param.service    = OSServiceId_StopScheduleTable;
+    param.p1.table   = table;
+    return Os_Arch_Syscall(&param);
+#endif
+}
+
+/** @copydoc Os_NextScheduleTable_Internal */
+static __inline Os_StatusType Os_NextScheduleTable(Os_ScheduleTableType from, Os_ScheduleTableType to)
+{
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_NextScheduleTable, from, to, 0u);
+#else
+    Os_SyscallParamType param;
+    param.service    = OSServiceId_NextScheduleTable;
+    param.p1.table   = from;
+    param.p2.table   = to;
+    return Os_Arch_Syscall(&param);
+#endif
+}
+
+/** @copydoc Os_GetScheduleTableStatus_Internal */
+static __inline Os_StatusType Os_GetScheduleTableStatus(Os_ScheduleTableType table, Os_ScheduleTableStatusType* status)
+{
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_GetScheduleTableStatus, table, status, 0u);
+#else
+    Os_SyscallParamType param;
+    param.service       = OSServiceId_GetScheduleTableStatus;
+    param.p1.table      = table;
+    param.p2.status_ptr = status;
+    return Os_Arch_Syscall(&param);
+#endif
+}
+#endif
+
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC1) ||  (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) )
+/** @copydoc Os_SetEvent_Internal */
+static __inline Os_StatusType Os_SetEvent(Os_TaskType task, Os_EventMaskType mask)
+{
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_SetEvent, task, mask, 0u);
+#else
+    Os_SyscallParamType param;
+    param.service    = OSServiceId_SetEvent;
+    param.p1.task    = task;
+    param.p2.mask    = mask;
+    return Os_Arch_Syscall(&param);
+#endif
+}
+
+/** @copydoc Os_ClearEvent_Internal */
+static __inline Os_StatusType Os_ClearEvent(Os_EventMaskType mask)
+{
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_ClearEvent, 0u, mask, 0u);
+#else
+    Os_SyscallParamType param;
+    param.service    = OSServiceId_ClearEvent;
+    param.p2.mask    = mask;
+    return Os_Arch_Syscall(&param);
+#endif
+}
+
+/** @copydoc Os_GetEvent_Internal */
+static __inline Os_StatusType Os_GetEvent(Os_TaskType task, Os_EventMaskType* mask)
+{
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_GetEvent, task, mask, 0u);
+#else
+    Os_SyscallParamType param;
+    param.service     = OSServiceId_GetEvent;
+    param.p1.task     = task;
+    param.p2.mask_ptr = mask;
+    return Os_Arch_Syscall(&param);
+#endif
+}
+
+/** @copydoc Os_WaitEvent_Internal */
+static __inline Os_StatusType Os_WaitEvent(Os_EventMaskType mask)
+{
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_WaitEvent, 0u, mask, 0u);
+#else
+    Os_SyscallParamType param;
+    param.service    = OSServiceId_WaitEvent;
+    param.p2.mask    = mask;
+    return Os_Arch_Syscall(&param);
+#endif
+}
+
+#ifdef OS_TASKGROUP_COUNT
+/** @copydoc Os_SetEventGroup_Internal */
+static __inline Os_StatusType Os_SetEventGroup(Os_TaskGroupType group, Os_EventMaskType mask)
+{
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_SetEventGroup, group, mask, 0u);
+#else
+    Os_SyscallParamType param;
+    param.service    = OSServiceId_SetEventGroup;
+    param.p1.group   = group;
+    param.p2.mask    = mask;
+    return Os_Arch_Syscall(&param);
+#endif
 }
+#endif
+
+#ifdef OS_ALARM_COUNT
+/**
+ * @copydoc Os_WaitEventTimeout_Internal
+ *
+ * The kernel only learns why the task woke up once it runs again, so the
+ * reason is picked up here after the syscall returned.
+ */
+static __inline Os_StatusType Os_WaitEventTimeout(Os_EventMaskType mask, Os_TickType ticks)
+{
+    Os_StatusType res;
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    res = OS_SYSCALL_DIRECT(OSServiceId_WaitEventTimeout, mask, ticks, 0u);
+#else
+    Os_SyscallParamType param;
+    param.service    = OSServiceId_WaitEventTimeout;
+    param.p1.mask    = mask;
+    param.p2.tick[0] = ticks;
+    res = Os_Arch_Syscall(&param);
+#endif
+    if ((res == E_OK) && Os_TaskControls[Os_ActiveTask].timeout) {
+        res = E_OS_SYS_TIMEOUT;
+    }
+    return res;
+}
+#endif
+#endif
 
 static __inline Os_StatusType Os_IncrementCounter(Os_CounterType counter)
 {
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_CounterIncrement, counter, 0u, 0u);
+#else
     Os_SyscallParamType param;
     param.service    = OSServiceId_CounterIncrement;
     param.p1.counter = counter;
     return Os_Arch_Syscall(&param);
+#endif
+}
+
+static __inline Os_StatusType Os_AdvanceCounter(Os_CounterType counter, Os_TickType ticks)
+{
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_CounterAdvance, counter, ticks, 0u);
+#else
+    Os_SyscallParamType param;
+    param.service    = OSServiceId_CounterAdvance;
+    param.p1.counter = counter;
+    param.p2.tick[0] = ticks;
+    return Os_Arch_Syscall(&param);
+#endif
 }
 
 static __inline Os_StatusType Os_Shutdown(void)
 {
+#if(OS_SYSCALL_DIRECT_ENABLE)
+    return OS_SYSCALL_DIRECT(OSServiceId_Shutdown, 0u, 0u, 0u);
+#else
     Os_SyscallParamType param;
     param.service  = OSServiceId_Shutdown;
     return Os_Arch_Syscall(&param);
+#endif
 }
 
 /**
@@ -96,7 +96,8 @@ void       Os_Arch_Start(void);
 #pragma INLINE
 static __inline void Os_Arch_Wait(void)
 {
-    /* NOP */
+    /* stop the cpu clocks until the next interrupt */
+    __asm("wai");
 }
 
 #endif /* OS_ARCH_HCS12_H_ */
@@ -16,21 +16,85 @@
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
  */
 
+#include "Os.h"
+
+#if !defined(OS_ARCH_POSIX_UCONTEXT) && !defined(__x86_64__) && !defined(__aarch64__)
+#define OS_ARCH_POSIX_UCONTEXT /**< no hand written switch for this cpu */
+#endif
+
+#ifdef OS_ARCH_POSIX_UCONTEXT
 #include <ucontext.h>
+#endif
 #include <signal.h>
 #include <sys/time.h>
+#include <time.h>
+#include <unistd.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdarg.h>
-#include "Os.h"
+
+#if defined(__linux__) && defined(OS_ISR_COUNT)
+#define OS_ARCH_POSIX_EPOLL /**< vectors can be bound to file descriptors watched by an io thread */
+#include <errno.h>
+#include <pthread.h>
+#include <sys/epoll.h>
+#endif
+
+#if defined(_POSIX_TIMERS) && (_POSIX_TIMERS > 0)
+#define OS_ARCH_POSIX_TIMERS /**< one posix timer per timer driven counter, else one setitimer at the shortest period */
+#endif
 
 typedef struct Os_Arch_CtxType {
+#ifdef OS_ARCH_POSIX_UCONTEXT
     ucontext_t ctx;
+#else
+    void*      sp;   /**< stack pointer of stored state, or top of stack before start */
+#endif
     boolean    run;
 } Os_Arch_CtxType;
 
+typedef struct Os_Arch_CounterType {
+    uint64     last;   /**< CLOCK_MONOTONIC time in us the counter has been advanced to */
+    uint32     period; /**< tick period in us, 0 if the counter is not timer driven */
+#ifdef OS_ARCH_POSIX_TIMERS
+    timer_t    timer;  /**< timer raising SIGALRM each period */
+    boolean    armed;  /**< timer has been created */
+#endif
+} Os_Arch_CounterType;
+
 Os_Arch_CtxType  Os_Arch_State_None;
 Os_Arch_CtxType  Os_Arch_State[OS_TASK_COUNT];
+
+volatile Os_IrqState  Os_Arch_Interrupt_Mask;    /**< virtual interrupt mask, the signals themselves are never blocked */
+volatile Os_IrqState  Os_Arch_Interrupt_Pending; /**< interrupts raised and not yet served, same bits as the mask */
+#ifdef OS_ISR_COUNT
+Os_IrqState           Os_Arch_IsrLevel[OS_ISR_COUNT]; /**< vectors masked while the handler of each vector runs */
+
+typedef char Os_Arch_IsrCountCheck[(OS_ISR_COUNT <= 30u) ? 1 : -1];
+#endif
+#ifdef OS_ARCH_POSIX_EPOLL
+int                   Os_Arch_Epoll = -1;        /**< epoll instance of the io thread, -1 before the first binding */
+int                   Os_Arch_IsrFd[OS_ISR_COUNT]; /**< descriptor bound to each vector, -1 if none, valid once Os_Arch_Epoll is */
+#endif
+Os_Arch_CounterType   Os_Arch_Counters[OS_COUNTER_COUNT];
+
+#ifndef OS_ARCH_POSIX_UCONTEXT
+void*            Os_Arch_Discard; /**< target for state that is never resumed */
+
+extern void Os_Arch_SwapState (void** save, void* load);
+extern void Os_Arch_StartState(void** save, void* top, void (*entry)(void));
+#endif
+
+/**
+ * @brief First function to run on a fresh task stack
+ *
+ * Tasks are started with interrupts enabled.
+ */
+static void Os_Arch_TaskStart(void)
+{
+    Os_Arch_EnableAllInterrupts();
+    Os_TaskConfigs[Os_ActiveTask].entry();
+}
 Os_StatusType Os_Arch_Syscall(Os_SyscallParamType *param);
 
 static __inline Os_Arch_CtxType * Os_Arch_GetContext(void)
@@ -47,99 +111,573 @@ static __inline Os_Arch_CtxType * Os_Arch_GetContext(void)
     return ctx;
 }
 
-void Os_Arch_Alarm(int signal)
+/**
+ * @brief Switch to whatever context the kernel selected
+ * @param ctx_before context that was running when the kernel was entered
+ *
+ * If the state of ctx_before was prepared again while in the kernel, its
+ * stack is being restarted and the current state is dropped.
+ */
+static __inline void Os_Arch_Switch(Os_Arch_CtxType* ctx_before)
 {
-    Os_Arch_CtxType* ctx_before;
     Os_Arch_CtxType* ctx_after;
 
-    ctx_before = Os_Arch_GetContext();
-    Os_Isr();
     ctx_after  = Os_Arch_GetContext();
 
+#ifdef OS_ARCH_POSIX_UCONTEXT
     if (ctx_before->run == FALSE) {
-         ctx_after->run = TRUE;
-         setcontext(&ctx_after->ctx);
-     } else if (ctx_before != ctx_after) {
-         ctx_after->run = TRUE;
-         swapcontext(&ctx_before->ctx, &ctx_after->ctx);
-     } else {
-         /* nop */
-     }
+        ctx_after->run = TRUE;
+        setcontext(&ctx_after->ctx);
+    } else if (ctx_before != ctx_after) {
+        ctx_after->run = TRUE;
+        swapcontext(&ctx_before->ctx, &ctx_after->ctx);
+    } else {
+        /* nop */
+    }
+#else
+    if ((ctx_before->run == FALSE) || (ctx_before != ctx_after)) {
+        void** save;
+        if (ctx_before->run == FALSE) {
+            save = &Os_Arch_Discard;
+        } else {
+            save = &ctx_before->sp;
+        }
+
+        if (ctx_after->run == FALSE) {
+            ctx_after->run = TRUE;
+            Os_Arch_StartState(save, ctx_after->sp, Os_Arch_TaskStart);
+        } else {
+            Os_Arch_SwapState(save, ctx_after->sp);
+        }
+    }
+#endif
+}
+
+/**
+ * @brief Read CLOCK_MONOTONIC in microseconds
+ */
+static uint64 Os_Arch_Now(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64)ts.tv_sec * 1000000u + (uint64)ts.tv_nsec / 1000u;
+}
+
+/**
+ * @brief Get the tick period in us of the timer driving given counter, 0 if none
+ */
+static uint32 Os_Arch_CounterPeriod(Os_CounterType counter)
+{
+    uint32 period = 0u;
+    if ((Os_CounterConfigs == NULL) || (Os_CounterConfigs[counter].source == OS_COUNTER_SOURCE_DEFAULT)) {
+        if (counter == OS_COUNTER_SYSTEM) {
+            period = OS_TICK_US;
+        }
+    } else if (Os_CounterConfigs[counter].source == OS_COUNTER_SOURCE_TIMER) {
+        period = Os_CounterConfigs[counter].period;
+        if (period == 0u) {
+            period = OS_TICK_US;
+        }
+    }
+    return period;
+}
+
+/**
+ * @brief Advance each timer driven counter by the ticks elapsed since last time
+ *
+ * SIGALRM does not queue, when the process is descheduled, interrupts are
+ * held off or several counter timers expire together, the expiries
+ * collapse into one signal. The number of ticks of each counter is
+ * therefore taken from the monotonic clock. Timers never expire early, so
+ * only whole elapsed periods are counted.
+ */
+static void Os_Arch_Tick(void)
+{
+    uint64               now = Os_Arch_Now();
+    uint64               elapsed;
+    Os_TickType          ticks;
+    Os_CounterType       counter;
+    Os_Arch_CounterType* state;
+
+    for (counter = 0u; counter < OS_COUNTER_COUNT; ++counter) {
+        state = &Os_Arch_Counters[counter];
+        if (state->period == 0u) {
+            continue;
+        }
+
+        elapsed = (now - state->last) / state->period;
+        while (elapsed > 0u) {
+            if (elapsed > (Os_TickType)-1) {
+                ticks = (Os_TickType)-1;
+            } else {
+                ticks = (Os_TickType)elapsed;
+            }
+            elapsed     -= ticks;
+            state->last += (uint64)ticks * state->period;
+            Os_CounterIsr(counter, ticks);
+        }
+    }
+}
+
+/**
+ * @brief Start the timers of all timer driven counters
+ *
+ * Timers of a previous Os_Init are stopped first. Without posix timers a
+ * single interval timer runs at the shortest period, counters with other
+ * periods are then advanced up to one shortest period late.
+ */
+static void Os_Arch_TimerInit(void)
+{
+    uint64               now      = Os_Arch_Now();
+    Os_CounterType       counter;
+    Os_Arch_CounterType* state;
+    int                  res;
+#ifdef OS_ARCH_POSIX_TIMERS
+    struct sigevent      sev;
+    struct itimerspec    val;
+#else
+    uint32               shortest = 0u;
+    struct itimerval     val;
+#endif
+
+    for (counter = 0u; counter < OS_COUNTER_COUNT; ++counter) {
+        state         = &Os_Arch_Counters[counter];
+        state->period = Os_Arch_CounterPeriod(counter);
+        state->last   = now;
+
+#ifdef OS_ARCH_POSIX_TIMERS
+        if (state->armed) {
+            (void)timer_delete(state->timer);
+            state->armed = FALSE;
+        }
+        if (state->period == 0u) {
+            continue;
+        }
+
+        memset(&sev, 0, sizeof(sev));
+        sev.sigev_notify = SIGEV_SIGNAL;
+        sev.sigev_signo  = SIGALRM;
+        res = timer_create(CLOCK_MONOTONIC, &sev, &state->timer);
+        if (res == -1) {
+            exit(-1);
+        }
+        state->armed = TRUE;
+
+        val.it_interval.tv_sec  = val.it_value.tv_sec  = state->period / 1000000u;
+        val.it_interval.tv_nsec = val.it_value.tv_nsec = (state->period % 1000000u) * 1000u;
+        res = timer_settime(state->timer, 0, &val, NULL);
+        if (res == -1) {
+            exit(-1);
+        }
+#else
+        if ((state->period != 0u) && ((shortest == 0u) || (state->period < shortest))) {
+            shortest = state->period;
+        }
+#endif
+    }
+
+#ifndef OS_ARCH_POSIX_TIMERS
+    val.it_interval.tv_sec  = val.it_value.tv_sec  = shortest / 1000000u;
+    val.it_interval.tv_usec = val.it_value.tv_usec = shortest % 1000000u;
+    res = setitimer(ITIMER_REAL, &val, NULL);
+    if (res == -1) {
+        exit(-1);
+    }
+#endif
+}
+
+/**
+ * @brief Select the highest priority interrupt pending and not masked
+ * @param mask mask to check against, without OS_ARCH_IRQ_DISABLED
+ * @return bit of the interrupt to serve, 0 if none
+ *
+ * The counter timers are above all vectors, equal vectors are served
+ * lowest number first.
+ */
+static Os_IrqState Os_Arch_Servable(Os_IrqState mask)
+{
+    Os_IrqState pending = Os_Arch_Interrupt_Pending & ~mask;
+    Os_IrqState irq     = 0u;
+#ifdef OS_ISR_COUNT
+    Os_IsrType  isr;
+    Os_IsrType  best    = 0u;
+#endif
+
+    if (pending & OS_ARCH_IRQ_TIMER) {
+        irq = OS_ARCH_IRQ_TIMER;
+    }
+#ifdef OS_ISR_COUNT
+    else {
+        for (isr = 0u; isr < OS_ISR_COUNT; ++isr) {
+            if ((pending & ((Os_IrqState)1u << isr))
+            &&  ((irq == 0u) || (Os_IsrConfigs[isr].priority > Os_IsrConfigs[best].priority))) {
+                irq  = (Os_IrqState)1u << isr;
+                best = isr;
+            }
+        }
+    }
+#endif
+    return irq;
+}
+
+#ifdef OS_ARCH_POSIX_EPOLL
+/**
+ * @brief Let the bound descriptor of a vector raise it again
+ *
+ * Descriptors are watched one shot, so a descriptor that stays readable
+ * raises its vector once per served handler, like a level triggered
+ * interrupt acknowledged at the end of its handler.
+ */
+static void Os_Arch_IsrRearm(Os_IsrType isr)
+{
+    struct epoll_event ev;
+    if (Os_Arch_IsrFd[isr] != -1) {
+        memset(&ev, 0, sizeof(ev));
+        ev.events   = EPOLLIN | EPOLLONESHOT;
+        ev.data.u32 = isr;
+        (void)epoll_ctl(Os_Arch_Epoll, EPOLL_CTL_MOD, Os_Arch_IsrFd[isr], &ev);
+    }
+}
+#endif
+
+/**
+ * @brief Serve one interrupt
+ * @param mask mask of the interrupted code
+ * @param irq  bit of the interrupt to serve
+ *
+ * Called with interrupts disabled. A vector handler is entered at a mask
+ * that also holds off all vectors of the same or lower priority, which the
+ * kernel applies when it enables interrupts for the handler.
+ */
+static void Os_Arch_Serve(Os_IrqState mask, Os_IrqState irq)
+{
+#ifdef OS_ISR_COUNT
+    Os_IsrType isr;
+#endif
+
+    if (irq == OS_ARCH_IRQ_TIMER) {
+        Os_Arch_Tick();
+    }
+#ifdef OS_ISR_COUNT
+    else {
+        for (isr = 0u; irq != ((Os_IrqState)1u << isr); ++isr) {
+            ;
+        }
+        Os_Arch_Interrupt_Mask = mask | Os_Arch_IsrLevel[isr] | OS_ARCH_IRQ_DISABLED;
+        Os_Isr2(isr);
+        Os_Arch_Interrupt_Mask = mask | OS_ARCH_IRQ_DISABLED;
+#ifdef OS_ARCH_POSIX_EPOLL
+        Os_Arch_IsrRearm(isr);
+#endif
+    }
+#else
+    (void)mask;
+#endif
+}
+
+/**
+ * @brief Serve pending interrupts then lower the virtual interrupt mask
+ * @param mask mask to run at when done, without OS_ARCH_IRQ_DISABLED
+ *
+ * Must be called with interrupts disabled. Pending interrupts are checked
+ * again after the mask is lowered, one raised after that check finds it
+ * lowered and is served by the signal handler itself.
+ *
+ * A handler enabling interrupts again comes back here nested, the kernel
+ * then holds off any task switch until the outermost handler returns.
+ */
+static void Os_Arch_Unmask(Os_IrqState mask)
+{
+    Os_Arch_CtxType* ctx_before;
+    Os_IrqState      irq;
+
+    do {
+        while ((irq = Os_Arch_Servable(mask)) != 0u) {
+            (void)__sync_fetch_and_and(&Os_Arch_Interrupt_Pending, ~irq);
+            ctx_before = Os_Arch_GetContext();
+            Os_Arch_Serve(mask, irq);
+            Os_Arch_Switch(ctx_before);
+        }
+        Os_Arch_Interrupt_Mask = mask;
+        if (Os_Arch_Servable(mask) == 0u) {
+            break;
+        }
+        Os_Arch_Interrupt_Mask = mask | OS_ARCH_IRQ_DISABLED;
+    } while (1);
+}
+
+/**
+ * @brief Mark interrupts pending and serve them if the mask allows
+ *
+ * Safe to call from signal handlers and from any kernel or task code.
+ */
+static void Os_Arch_Raise(Os_IrqState irq)
+{
+    Os_IrqState mask;
+
+    (void)__sync_fetch_and_or(&Os_Arch_Interrupt_Pending, irq);
+    mask = Os_Arch_Interrupt_Mask;
+    if (((mask & OS_ARCH_IRQ_DISABLED) == 0u) && (Os_Arch_Servable(mask) != 0u)) {
+        Os_Arch_Interrupt_Mask = mask | OS_ARCH_IRQ_DISABLED;
+        Os_Arch_Unmask(mask);
+    }
 }
 
+void Os_Arch_Alarm(int signal)
+{
+    (void)signal;
+    Os_Arch_Raise(OS_ARCH_IRQ_TIMER);
+}
+
+#ifdef OS_ISR_COUNT
+/**
+ * @brief Handler of the real time signal carrying vector numbers
+ *
+ * Queued by the io thread with the vector in the signal value, so vectors
+ * raised together are not collapsed into one signal.
+ */
+static void Os_Arch_Vector(int signal, siginfo_t* info, void* context)
+{
+    (void)signal;
+    (void)context;
+    if ((info->si_value.sival_int >= 0) && (info->si_value.sival_int < OS_ISR_COUNT)) {
+        Os_Arch_Raise((Os_IrqState)1u << info->si_value.sival_int);
+    }
+}
+#endif
+
+#ifdef OS_ARCH_POSIX_EPOLL
+/**
+ * @brief Io thread turning readable descriptors into vectors
+ *
+ * Runs with all signals blocked, so timer and vector signals are only
+ * taken by the thread running the kernel. The descriptor stays disarmed
+ * until the vector is served, so a signal refused by a full queue is
+ * retried once the kernel drained some, else the vector would be lost.
+ */
+static void* Os_Arch_IoThread(void* arg)
+{
+    static const struct timespec retry = { 0, 100000 };
+    struct epoll_event ev[8];
+    union sigval       value;
+    int                count;
+    int                index;
+
+    (void)arg;
+    while (1) {
+        count = epoll_wait(Os_Arch_Epoll, ev, (int)(sizeof(ev) / sizeof(ev[0])), -1);
+        for (index = 0; index < count; ++index) {
+            value.sival_int = (int)ev[index].data.u32;
+            while ((sigqueue(getpid(), SIGRTMIN, value) != 0) && (errno == EAGAIN)) {
+                (void)nanosleep(&retry, NULL);
+            }
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Bind a file descriptor to a vector
+ * @param isr vector to raise
+ * @param fd  descriptor raising the vector while readable, -1 to unbind
+ * @return
+ *  - E_OK       on success
+ *  - E_OS_ID    if <isr> is invalid
+ *  - E_OS_LIMIT if the io thread could not be set up
+ *  - E_OS_VALUE if the descriptor <fd> could not be watched
+ *
+ * Any descriptor epoll can watch works, such as an eventfd, a pipe, a
+ * socket or a timerfd. The handler must read the descriptor until it is no
+ * longer readable, else the vector is raised again after it returns.
+ * Bindings are dropped by Os_Init, so bind after it.
+ */
+Os_StatusType Os_Arch_BindIsr(Os_IsrType isr, int fd)
+{
+    struct epoll_event ev;
+    sigset_t           all;
+    sigset_t           prev;
+    pthread_t          thread;
+    Os_IsrType         thread_isr;
+    Os_StatusType      res = E_OK;
+    Os_IrqState        state;
+
+    Os_Arch_SuspendInterrupts(&state);
+    if (isr >= OS_ISR_COUNT) {
+        res = E_OS_ID;
+    } else if (Os_Arch_Epoll == -1) {
+        for (thread_isr = 0u; thread_isr < OS_ISR_COUNT; ++thread_isr) {
+            Os_Arch_IsrFd[thread_isr] = -1;
+        }
+        Os_Arch_Epoll = epoll_create(OS_ISR_COUNT);
+        if (Os_Arch_Epoll == -1) {
+            res = E_OS_LIMIT;
+        } else {
+            (void)sigfillset(&all);
+            (void)pthread_sigmask(SIG_SETMASK, &all, &prev);
+            if (pthread_create(&thread, NULL, Os_Arch_IoThread, NULL) == 0) {
+                (void)pthread_detach(thread);
+            } else {
+                (void)close(Os_Arch_Epoll);
+                Os_Arch_Epoll = -1;
+                res = E_OS_LIMIT;
+            }
+            (void)pthread_sigmask(SIG_SETMASK, &prev, NULL);
+        }
+    }
+
+    if (res == E_OK) {
+        if (Os_Arch_IsrFd[isr] != -1) {
+            (void)epoll_ctl(Os_Arch_Epoll, EPOLL_CTL_DEL, Os_Arch_IsrFd[isr], NULL);
+            Os_Arch_IsrFd[isr] = -1;
+        }
+        if (fd != -1) {
+            memset(&ev, 0, sizeof(ev));
+            ev.events   = EPOLLIN | EPOLLONESHOT;
+            ev.data.u32 = isr;
+            if (epoll_ctl(Os_Arch_Epoll, EPOLL_CTL_ADD, fd, &ev) == 0) {
+                Os_Arch_IsrFd[isr] = fd;
+            } else {
+                res = E_OS_VALUE;
+            }
+        }
+    }
+    Os_Arch_ResumeInterrupts(&state);
+    return res;
+}
+#endif
+
 void Os_Arch_Init(void)
 {
     int res;
-    Os_TaskType task;
+#ifdef OS_ISR_COUNT
+    Os_IsrType  isr;
+    Os_IsrType  other;
+#endif
     Os_Arch_DisableAllInterrupts();
+    Os_Arch_Interrupt_Pending = 0u;
 
     memset(&Os_Arch_State_None, 0, sizeof(Os_Arch_State_None));
     memset(&Os_Arch_State, 0, sizeof(Os_Arch_State));
     Os_Arch_State_None.run = TRUE;
+#ifdef OS_ARCH_POSIX_UCONTEXT
+    Os_TaskType task;
     for (task = 0u; task < OS_TASK_COUNT; ++task) {
         ucontext_t* ctx = &Os_Arch_State[task].ctx;
         getcontext(ctx);
     }
+#endif
+
+#ifdef OS_ISR_COUNT
+    for (isr = 0u; isr < OS_ISR_COUNT; ++isr) {
+        Os_Arch_IsrLevel[isr] = 0u;
+        for (other = 0u; other < OS_ISR_COUNT; ++other) {
+            if (Os_IsrConfigs[other].priority <= Os_IsrConfigs[isr].priority) {
+                Os_Arch_IsrLevel[isr] |= (Os_IrqState)1u << other;
+            }
+        }
+#ifdef OS_ARCH_POSIX_EPOLL
+        if ((Os_Arch_Epoll != -1) && (Os_Arch_IsrFd[isr] != -1)) {
+            (void)epoll_ctl(Os_Arch_Epoll, EPOLL_CTL_DEL, Os_Arch_IsrFd[isr], NULL);
+            Os_Arch_IsrFd[isr] = -1;
+        }
+#endif
+    }
+#endif
 
     struct sigaction sact;
     memset(&sact, 0, sizeof(sact));
     sigemptyset( &sact.sa_mask );
-    sact.sa_flags   = SA_RESTART;
+    sact.sa_flags   = SA_RESTART | SA_NODEFER; /* masking is done by Os_Arch_Interrupt_Mask */
     sact.sa_handler = Os_Arch_Alarm;
     res = sigaction(SIGALRM, &sact, NULL);
     if (res == -1) {
         exit(-1);
     }
 
-     // start up the "interrupt"!
-    struct itimerval val;
-    val.it_interval.tv_sec  = val.it_value.tv_sec  = OS_TICK_US / 1000000u;
-    val.it_interval.tv_usec = val.it_value.tv_usec = OS_TICK_US % 1000000u;
-    res = setitimer(ITIMER_REAL, &val, NULL);
+#ifdef OS_ISR_COUNT
+    sact.sa_flags     = SA_RESTART | SA_NODEFER | SA_SIGINFO;
+    sact.sa_sigaction = Os_Arch_Vector;
+    res = sigaction(SIGRTMIN, &sact, NULL);
     if (res == -1) {
         exit(-1);
     }
+#endif
+
+     // start up the "interrupts"!
+    Os_Arch_TimerInit();
 }
 
 void Os_Arch_SuspendInterrupts(Os_IrqState* mask)
 {
-    sigset_t  set;
-    sigemptyset(&set);
-    sigaddset(&set, SIGALRM);
-    sigprocmask(SIG_BLOCK, &set, mask);
+    *mask = Os_Arch_Interrupt_Mask;
+    Os_Arch_Interrupt_Mask = *mask | OS_ARCH_IRQ_DISABLED;
 }
 
 void Os_Arch_ResumeInterrupts(const Os_IrqState* mask)
 {
-    sigprocmask(SIG_SETMASK, mask, NULL);
+    if ((*mask & OS_ARCH_IRQ_DISABLED) == 0u) {
+        /* serve any queued up interrupts the restored mask lets through first */
+        Os_Arch_Interrupt_Mask |= OS_ARCH_IRQ_DISABLED;
+        Os_Arch_Unmask(*mask);
+    } else {
+        Os_Arch_Interrupt_Mask = *mask;
+    }
 }
 
 void Os_Arch_DisableAllInterrupts(void)
 {
-    sigset_t  set;
-    sigemptyset(&set);
-    sigaddset(&set, SIGALRM);
-    sigprocmask(SIG_BLOCK, &set, NULL);
+    Os_Arch_Interrupt_Mask |= OS_ARCH_IRQ_DISABLED;
 }
 
 void Os_Arch_EnableAllInterrupts(void)
 {
-    sigset_t  set;
-    sigemptyset(&set);
-    sigaddset(&set, SIGALRM);
-    sigprocmask(SIG_UNBLOCK, &set, NULL);
+    Os_IrqState mask = Os_Arch_Interrupt_Mask & ~OS_ARCH_IRQ_DISABLED;
+    Os_Arch_Interrupt_Mask = mask | OS_ARCH_IRQ_DISABLED;
+    Os_Arch_Unmask(mask);
+}
+
+#ifdef OS_ISR_COUNT
+/**
+ * @brief Raise a vector in software
+ * @param[in] isr vector to raise
+ *
+ * Stands in for a peripheral interrupt on the host. The vector is served
+ * at once if the mask lets it through, including from inside the handler
+ * of a lower priority vector, else as soon as the mask is lowered.
+ */
+void Os_Arch_RaiseIsr(Os_IsrType isr)
+{
+    Os_Arch_Raise((Os_IrqState)1u << isr);
+}
+
+/**
+ * @brief Mask a vector and all vectors of the same or lower priority
+ * @param[in]  isr  vector to mask
+ * @param[out] mask previous mask, for Os_Arch_ResumeInterrupts
+ *
+ * Higher priority vectors and the counter timers are still served.
+ */
+void Os_Arch_SuspendIsr(Os_IsrType isr, Os_IrqState* mask)
+{
+    *mask = Os_Arch_Interrupt_Mask;
+    Os_Arch_Interrupt_Mask = *mask | Os_Arch_IsrLevel[isr];
 }
+#endif
 
 void Os_Arch_PrepareState(Os_TaskType task)
 {
     Os_Arch_CtxType* ctx = &Os_Arch_State[task];
-    sigdelset(&ctx->ctx.uc_sigmask, SIGALRM); /* we start with interrupts enabled */
+#ifdef OS_ARCH_POSIX_UCONTEXT
     ctx->ctx.uc_link           = NULL;
     ctx->ctx.uc_stack.ss_size  = Os_TaskConfigs[task].stack_size;
     ctx->ctx.uc_stack.ss_sp    = Os_TaskConfigs[task].stack;
     ctx->ctx.uc_stack.ss_flags = 0;
+    makecontext(&ctx->ctx, Os_Arch_TaskStart, 0);
+#else
+    /* nothing is written to the stack here, it may be the one we run on */
+    ctx->sp = (uint8*)Os_TaskConfigs[task].stack + Os_TaskConfigs[task].stack_size;
+#endif
     ctx->run = FALSE;
-    makecontext(&ctx->ctx, Os_TaskConfigs[task].entry, 0);
 }
 
 Os_StatusType Os_Arch_Syscall(Os_SyscallParamType* param)
@@ -147,33 +685,60 @@ Os_StatusType Os_Arch_Syscall(Os_SyscallParamType* param)
     Os_StatusType    res;
     Os_IrqState      state;
     Os_Arch_CtxType* ctx_before;
-    Os_Arch_CtxType* ctx_after;
     Os_Arch_SuspendInterrupts(&state);
 
     ctx_before = Os_Arch_GetContext();
     res = Os_Syscall_Internal(param);
-    ctx_after  = Os_Arch_GetContext();
+    Os_Arch_Switch(ctx_before);
 
-    if (ctx_before->run == FALSE) {
-        ctx_after->run = TRUE;
-        setcontext(&ctx_after->ctx);
-    } else if (ctx_before != ctx_after) {
-        ctx_after->run = TRUE;
-        swapcontext(&ctx_before->ctx, &ctx_after->ctx);
-    } else {
-        /* nop */
-    }
+    Os_Arch_ResumeInterrupts(&state);
+    return res;
+}
+
+#if(OS_SYSCALL_DIRECT_ENABLE)
+Os_StatusType Os_Arch_SyscallDirect(Os_ServiceIdType service, Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    Os_StatusType    res;
+    Os_IrqState      state;
+    Os_Arch_CtxType* ctx_before;
+    Os_Arch_SuspendInterrupts(&state);
+
+    ctx_before = Os_Arch_GetContext();
+    res = Os_Syscall_Direct(service, a0, a1, a2);
+    Os_Arch_Switch(ctx_before);
 
     Os_Arch_ResumeInterrupts(&state);
     return res;
 }
+#endif
 
 void Os_Arch_Start(void)
 {
-    Os_Arch_CtxType* ctx = Os_Arch_GetContext();
-    if (ctx != &Os_Arch_State_None) {
-        ctx->run = TRUE;
-        swapcontext(&Os_Arch_State_None.ctx, &ctx->ctx);
-    }
+    Os_Arch_Switch(&Os_Arch_State_None);
     Os_Arch_EnableAllInterrupts();
 }
+
+/**
+ * @brief Sleep until the next signal when no task is ready
+ *
+ * Ticks are served by the signal handler, which switches to any task it
+ * readied, so the idle loop only sees the signal once all tasks wait again.
+ * The signals are blocked while Os_Continue is checked and only unblocked
+ * by sigsuspend, so a shutdown from a handler between the check of the
+ * idle loop and the sleep can't leave it waiting for a signal that never
+ * comes.
+ */
+void Os_Arch_Wait(void)
+{
+    sigset_t block;
+    sigset_t prev;
+
+    (void)sigemptyset(&block);
+    (void)sigaddset(&block, SIGALRM);
+    (void)sigaddset(&block, SIGRTMIN);
+    (void)sigprocmask(SIG_BLOCK, &block, &prev);
+    if (Os_Continue) {
+        (void)sigsuspend(&prev);
+    }
+    (void)sigprocmask(SIG_SETMASK, &prev, NULL);
+}
@@ -21,7 +21,12 @@
 
 #include <signal.h>
 
-typedef    sigset_t Os_IrqState;
+typedef    uint32 Os_IrqState; /**< virtual interrupt mask, a bit per vector */
+
+#define OS_ARCH_IRQ_TIMER    ((Os_IrqState)1u << 30) /**< counter timers, above all vectors */
+#define OS_ARCH_IRQ_DISABLED ((Os_IrqState)1u << 31) /**< all interrupts disabled */
+
+#define OS_ARCH_SYSCALL_DIRECT 0 /**< direct abi is opt in, it measures no faster than the struct abi here */
 
 void       Os_Arch_Init(void);
 
@@ -34,10 +39,14 @@ void       Os_Arch_ResumeInterrupts(const Os_IrqState* mask);
 void       Os_Arch_PrepareState(Os_TaskType task);
 
 void       Os_Arch_Start(void);
-
-static __inline void Os_Arch_Wait(void)
-{
-    /* NOP */
-}
+void       Os_Arch_Wait(void);
+
+#ifdef OS_ISR_COUNT
+void       Os_Arch_RaiseIsr(Os_IsrType isr);
+void       Os_Arch_SuspendIsr(Os_IsrType isr, Os_IrqState* mask);
+#ifdef __linux__
+Os_StatusType Os_Arch_BindIsr(Os_IsrType isr, int fd);
+#endif
+#endif
 
 #endif /* OS_ARCH_POSIX_H_ */
@@ -25,16 +25,114 @@
 #define OS_TYPES_H_
 
 #include "Std_Types.h"
+#include "Os_Cfg.h"
 
-typedef uint8 Os_TaskType;        /**< task identifier */
-typedef uint8 Os_ResourceType;    /**< resource identifier */
-typedef sint8 Os_PriorityType;    /**< priority level */
+/**
+ * @brief Width in bits of Os_PriorityType, 8 or 16
+ *
+ * An 8 bit priority allows up to 127 priority levels, 16 bit is
+ * needed for larger configurations (up to the 1024 levels the ready
+ * bitmap can hold).
+ */
+#ifndef OS_PRIORITY_BITS
+#define OS_PRIORITY_BITS 8
+#endif
+
+/**
+ * @brief Width in bits of the task, resource and alarm identifiers, 8 or 16
+ *
+ * The largest value of each type is reserved for OS_INVALID_*, so an
+ * 8 bit identifier allows up to 255 objects of that kind.
+ */
+#ifndef OS_TASK_BITS
+#define OS_TASK_BITS 8
+#endif
+
+#ifndef OS_RESOURCE_BITS
+#define OS_RESOURCE_BITS 8
+#endif
+
+#ifndef OS_ALARM_BITS
+#define OS_ALARM_BITS 8
+#endif
+
+/**
+ * @brief Width in bits of Os_TickType, 16, 32 or 64
+ *
+ * Applies to every counter of the build. Relative alarm values and
+ * cycles are limited to half the tick range, so 16 bit ticks at 1 ms
+ * allow at most about 32 s, 32 bit ticks at 1 us about 35 minutes.
+ */
+#ifndef OS_TICK_BITS
+#define OS_TICK_BITS 16
+#endif
+
+/**
+ * @brief Width in bits of Os_EventMaskType, 8, 16 or 32
+ *
+ * Gives the number of events each extended task can wait for.
+ */
+#ifndef OS_EVENT_BITS
+#define OS_EVENT_BITS 8
+#endif
+
+#if   (OS_TASK_BITS == 8)
+typedef uint8  Os_TaskType;       /**< task identifier */
+#elif (OS_TASK_BITS == 16)
+typedef uint16 Os_TaskType;       /**< task identifier */
+#else
+#error "OS_TASK_BITS must be 8 or 16"
+#endif
+
+#if   (OS_RESOURCE_BITS == 8)
+typedef uint8  Os_ResourceType;   /**< resource identifier */
+#elif (OS_RESOURCE_BITS == 16)
+typedef uint16 Os_ResourceType;   /**< resource identifier */
+#else
+#error "OS_RESOURCE_BITS must be 8 or 16"
+#endif
+
+#if   (OS_PRIORITY_BITS == 8)
+typedef sint8  Os_PriorityType;   /**< priority level */
+#elif (OS_PRIORITY_BITS == 16)
+typedef sint16 Os_PriorityType;   /**< priority level */
+#else
+#error "OS_PRIORITY_BITS must be 8 or 16"
+#endif
 
 typedef uint8 Os_StatusType;      /**< return value for os functions */
 
+#if   (OS_ALARM_BITS == 8)
 typedef uint8  Os_AlarmType;      /**< alarm identifier */
+#elif (OS_ALARM_BITS == 16)
+typedef uint16 Os_AlarmType;      /**< alarm identifier */
+#else
+#error "OS_ALARM_BITS must be 8 or 16"
+#endif
 typedef uint8  Os_CounterType;    /**< counter identifer */
+typedef uint8  Os_ScheduleTableType; /**< schedule table identifier */
+typedef uint8  Os_TaskGroupType;  /**< task group identifier */
+typedef uint8  Os_IsrType;        /**< category 2 interrupt identifier */
+
+#if   (OS_TICK_BITS == 16)
 typedef uint16 Os_TickType;       /**< tick value identifier */
+#elif (OS_TICK_BITS == 32)
+typedef uint32 Os_TickType;       /**< tick value identifier */
+#elif (OS_TICK_BITS == 64)
+typedef uint64 Os_TickType;       /**< tick value identifier */
+#else
+#error "OS_TICK_BITS must be 16, 32 or 64"
+#endif
+
+#if   (OS_EVENT_BITS == 8)
+typedef uint8  Os_EventMaskType;  /**< bit mask of events */
+#elif (OS_EVENT_BITS == 16)
+typedef uint16 Os_EventMaskType;  /**< bit mask of events */
+#elif (OS_EVENT_BITS == 32)
+typedef uint32 Os_EventMaskType;  /**< bit mask of events */
+#else
+#error "OS_EVENT_BITS must be 8, 16 or 32"
+#endif
 
 #define OS_MAXALLOWEDVALUE UINT8_MAX
 
@@ -42,6 +140,7 @@ typedef uint16 Os_TickType;       /**< tick value identifier */
 #define OS_INVALID_RESOURCE  (Os_ResourceType)(-1)
 #define OS_INVALID_ALARM     (Os_AlarmType)(-1)
 #define OS_INVALID_COUNTER   (Os_CounterType)(-1)
+#define OS_INVALID_SCHEDULETABLE (Os_ScheduleTableType)(-1)
 
 #define OS_CONFORMANCE_BCC1 0u
 #define OS_CONFORMANCE_BCC2 1u
@@ -56,6 +155,7 @@ typedef enum Os_ContextType {
     OS_CONTEXT_TASK  = 1,         /**< OS_CONTEXT_TASK - Os currently called from a task */
     OS_CONTEXT_ISR1  = 2,         /**< OS_CONTEXT_ISR1 - Os currently called from interrupt category 1 */
     OS_CONTEXT_ISR2  = 3,         /**< OS_CONTEXT_ISR2 - Os currently called from interrupt category 2 */
+    OS_CONTEXT_ALARMCALLBACK = 4, /**< OS_CONTEXT_ALARMCALLBACK - Os currently running an alarm callback */
 } __attribute__ ((__packed__)) Os_ContextType;
 
 /**
@@ -69,6 +169,15 @@ typedef enum Os_TaskStateEnum {
     OS_TASK_READY_FIRST = 4,        /**< OS_TASK_READY_FIRST */
 } __attribute__ ((__packed__)) Os_TaskStateEnum;
 
+/**
+ * @brief State of a schedule table
+ */
+typedef enum Os_ScheduleTableStatusType {
+    OS_SCHEDULETABLE_STOPPED = 0,   /**< OS_SCHEDULETABLE_STOPPED - table is not processed */
+    OS_SCHEDULETABLE_NEXT    = 1,   /**< OS_SCHEDULETABLE_NEXT - table starts when the one it follows ends */
+    OS_SCHEDULETABLE_RUNNING = 2,   /**< OS_SCHEDULETABLE_RUNNING - table is being processed */
+} __attribute__ ((__packed__)) Os_ScheduleTableStatusType;
+
 #define OS_RES_SCHEDULER (Os_ResourceType)0
 
 typedef void          (*Os_TaskEntryType)(void); /**< type for the entry point of a task */
@@ -83,5 +192,6 @@ typedef void          (*Os_TaskEntryType)(void); /**< type for the entry point o
 #define E_OS_VALUE    (Os_StatusType)8
 
 #define E_OS_SYS_NOT_IMPLEMENTED (Os_StatusType)16
+#define E_OS_SYS_TIMEOUT         (Os_StatusType)17 /**< wait ended by its timeout rather than an event */
 
 #endif /* OS_TYPES_H_ */
@@ -0,0 +1,163 @@
+/* OSEKOS Implementation of an OSEK Scheduler
+ * Copyright (C) 2015 Joakim Plate
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file
+ * @ingroup Os_Cfg
+ *
+ * Alarm queue metric, a task keeps arming OS_METRIC_ALARM_COUNT alarms
+ * in scrambled order on a counter of its own. For the first tick of the
+ * system counter they are cancelled again in scrambled order, for the
+ * second one they are left to expire by incrementing the counter.
+ * With OS_METRIC_ALARM_WHEEL set the metric counter uses the timing wheel.
+ */
+
+#include "Std_Types.h"
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "Os.h"
+#include "Os_Cfg.h"
+#include "Os_Types.h"
+
+#ifdef __HIWARE__
+#define NAMED_INIT(a)
+#else
+#define NAMED_INIT(a) .a =
+#endif
+
+#define OS_METRIC_ALARM_STRIDE 7919u /* prime, visits all alarms in scrambled order */
+
+unsigned char task0_stack[TASK_STACK_SIZE];
+unsigned char task1_stack[TASK_STACK_SIZE];
+
+unsigned int  task0_count;
+unsigned int  task1_count;
+
+volatile unsigned int task0_phase;
+unsigned int  task0_cancel_count;
+unsigned int  task0_expire_count;
+
+void task0(void)
+{
+    unsigned int i;
+    while (1) {
+        for (i = 0u; i < OS_METRIC_ALARM_COUNT; ++i) {
+            Os_SetRelAlarm((Os_AlarmType)i, (Os_TickType)(1u + (i * OS_METRIC_ALARM_STRIDE) % OS_METRIC_ALARM_COUNT), 0u);
+        }
+        if (task0_phase == 0u) {
+            for (i = 0u; i < OS_METRIC_ALARM_COUNT; ++i) {
+                Os_CancelAlarm((Os_AlarmType)((i * OS_METRIC_ALARM_STRIDE) % OS_METRIC_ALARM_COUNT));
+            }
+            task0_cancel_count++;
+        } else {
+            for (i = 0u; i < OS_METRIC_ALARM_COUNT; ++i) {
+                Os_IncrementCounter(OS_COUNTER_METRIC);
+            }
+            task0_expire_count++;
+        }
+        task0_count++;
+    }
+}
+
+void task1(void)
+{
+    task1_count++;
+    if(task1_count == 1) {
+        Os_SetRelAlarm(OS_ALARM_SHUTDOWN, 1u, 1u);
+        Os_ActivateTask(0);
+        Os_TerminateTask();
+    } else if(task1_count == 2) {
+        task0_phase = 1u;
+        Os_TerminateTask();
+    } else {
+        Os_Shutdown();
+    }
+}
+
+const Os_TaskConfigType Os_DefaultTasks[OS_TASK_COUNT] = {
+          { NAMED_INIT(priority)    0,
+            NAMED_INIT(entry)       task0,
+            NAMED_INIT(stack)       task0_stack,
+            NAMED_INIT(stack_size)  sizeof(task0_stack),
+            NAMED_INIT(autostart)   0,
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) ||  (OS_CONFORMANCE == OS_CONFORMANCE_BCC2) )
+            NAMED_INIT(activation)  255u,
+#endif
+            NAMED_INIT(resource)    OS_INVALID_RESOURCE
+          }
+        , { NAMED_INIT(priority)    1,
+            NAMED_INIT(entry)       task1,
+            NAMED_INIT(stack)       task1_stack,
+            NAMED_INIT(stack_size)  sizeof(task1_stack),
+            NAMED_INIT(autostart)   1,
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) ||  (OS_CONFORMANCE == OS_CONFORMANCE_BCC2) )
+            NAMED_INIT(activation)  255u,
+#endif
+            NAMED_INIT(resource)    OS_INVALID_RESOURCE
+          }
+};
+
+const Os_ResourceConfigType Os_DefaultResources[OS_RES_COUNT] = {
+        {   NAMED_INIT(priority)  OS_PRIO_COUNT
+        },
+};
+
+/* filled in at startup, too many to list */
+Os_AlarmConfigType Os_DefaultAlarms[OS_ALARM_COUNT];
+
+#if(OS_METRIC_ALARM_WHEEL)
+const Os_CounterConfigType Os_DefaultCounters[OS_COUNTER_COUNT] = {
+        {   NAMED_INIT(queue)     OS_COUNTER_QUEUE_HEAP
+        },
+        {   NAMED_INIT(queue)     OS_COUNTER_QUEUE_WHEEL
+        },
+};
+#endif
+
+Os_ConfigType Os_DefaultConfig;
+
+int main(void)
+{
+    Os_AlarmType alarm;
+    for (alarm = 0u; alarm < OS_ALARM_COUNT; ++alarm) {
+        Os_DefaultAlarms[alarm].task    = OS_INVALID_TASK;
+        Os_DefaultAlarms[alarm].counter = OS_COUNTER_METRIC;
+    }
+    Os_DefaultAlarms[OS_ALARM_SHUTDOWN].task    = 1;
+    Os_DefaultAlarms[OS_ALARM_SHUTDOWN].counter = OS_COUNTER_SYSTEM;
+
+    Os_DefaultConfig.tasks     = &Os_DefaultTasks;
+    Os_DefaultConfig.resources = &Os_DefaultResources;
+    Os_DefaultConfig.alarms    = (const Os_AlarmConfigType (*)[OS_ALARM_COUNT])&Os_DefaultAlarms;
+#if(OS_METRIC_ALARM_WHEEL)
+    Os_DefaultConfig.counters  = &Os_DefaultCounters;
+#endif
+
+    Os_Init(&Os_DefaultConfig);
+    Os_Start();
+    printf("Execution counts %u (alarms %u, wheel %u, heap arity %u, arm and cancel %lu/s, arm and expire %lu/s)\n"
+            , task0_count
+            , (unsigned)OS_METRIC_ALARM_COUNT
+            , (unsigned)OS_METRIC_ALARM_WHEEL
+            , (unsigned)OS_ALARM_HEAP_ARITY
+            , (unsigned long)((double)task0_cancel_count * OS_METRIC_ALARM_COUNT * 1000000.0 / OS_TICK_US)
+            , (unsigned long)((double)task0_expire_count * OS_METRIC_ALARM_COUNT * 1000000.0 / OS_TICK_US));
+    return 0;
+}
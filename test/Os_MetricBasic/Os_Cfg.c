@@ -36,8 +36,8 @@
 #define NAMED_INIT(a) .a =
 #endif
 
-unsigned char task0_stack[512];
-unsigned char task1_stack[512];
+unsigned char task0_stack[TASK_STACK_SIZE];
+unsigned char task1_stack[TASK_STACK_SIZE];
 
 unsigned int  task0_count;
 unsigned int  task1_count;
@@ -24,8 +24,6 @@
 #ifndef OS_CFG_H_
 #define OS_CFG_H_
 
-#include "Os_Types.h"
-
 #define OS_TASK_COUNT  (Os_TaskType)2
 #define OS_PRIO_COUNT  (Os_PriorityType)2
 #define OS_RES_COUNT   (Os_ResourceType)1
@@ -34,8 +32,10 @@
 #ifdef OS_CFG_ARCH_HCS12
 #   define OS_ARCH_RTICTL_VALUE 0x17u
 #   define OS_TICK_US           1024U
+#   define TASK_STACK_SIZE      512u
 #else
 #   define OS_TICK_US           1000000U
+#   define TASK_STACK_SIZE      16384u
 #endif
 
 #define OS_PRETASKHOOK_ENABLE  0
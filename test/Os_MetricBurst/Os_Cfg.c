@@ -0,0 +1,165 @@
+/* OSEKOS Implementation of an OSEK Scheduler
+ * Copyright (C) 2015 Joakim Plate
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * Lesser General Public License for more details.
+
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ */
+
+/**
+ * @file
+ * @ingroup Os_Cfg
+ *
+ * Burst activation metric, each increment of the burst counter expires
+ * OS_BURST_COUNT alarms that activate tasks of increasing priority.
+ * With OS_METRIC_BURST_CALLBACK set the alarms run a callback instead.
+ */
+
+#include "Std_Types.h"
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "Os.h"
+#include "Os_Cfg.h"
+#include "Os_Types.h"
+
+#ifdef __HIWARE__
+#define NAMED_INIT(a)
+#else
+#define NAMED_INIT(a) .a =
+#endif
+
+#define TASK_DRIVER   0u
+#define TASK_SHUTDOWN (OS_BURST_COUNT + 1u)
+
+unsigned char task_stack[OS_TASK_COUNT][TASK_STACK_SIZE];
+
+unsigned int  driver_count;
+unsigned int  burst_count;
+unsigned int  shutdown_count;
+
+void task_driver(void)
+{
+    Os_AlarmType alarm;
+    for (alarm = 1u; alarm <= OS_BURST_COUNT; ++alarm) {
+        Os_SetRelAlarm(alarm, 1u, 1u);
+    }
+
+    while (1) {
+        driver_count++;
+        Os_IncrementCounter(OS_COUNTER_BURST);
+    }
+}
+
+void task_burst(void)
+{
+    burst_count++;
+    Os_TerminateTask();
+}
+
+void burst_callback(void)
+{
+    burst_count++;
+}
+
+void task_shutdown(void)
+{
+    shutdown_count++;
+    if(shutdown_count == 1) {
+        Os_SetRelAlarm(0, (1000ul*1000ul/OS_TICK_US)+1ul, 0u);
+        Os_ActivateTask(TASK_DRIVER);
+        Os_TerminateTask();
+    } else {
+        Os_Shutdown();
+    }
+}
+
+#if( (OS_CONFORMANCE == OS_CONFORMANCE_ECC2) ||  (OS_CONFORMANCE == OS_CONFORMANCE_BCC2) )
+#define TASK_CONFIG(_prio, _entry, _autostart)       \
+          { NAMED_INIT(priority)    _prio,           \
+            NAMED_INIT(entry)       _entry,          \
+            NAMED_INIT(stack)       task_stack[_prio], \
+            NAMED_INIT(stack_size)  TASK_STACK_SIZE, \
+            NAMED_INIT(autostart)   _autostart,      \
+            NAMED_INIT(activation)  255u,            \
+            NAMED_INIT(resource)    OS_INVALID_RESOURCE \
+          }
+#else
+#define TASK_CONFIG(_prio, _entry, _autostart)       \
+          { NAMED_INIT(priority)    _prio,           \
+            NAMED_INIT(entry)       _entry,          \
+            NAMED_INIT(stack)       task_stack[_prio], \
+            NAMED_INIT(stack_size)  TASK_STACK_SIZE, \
+            NAMED_INIT(autostart)   _autostart,      \
+            NAMED_INIT(resource)    OS_INVALID_RESOURCE \
+          }
+#endif
+
+const Os_TaskConfigType Os_DefaultTasks[OS_TASK_COUNT] = {
+          TASK_CONFIG(0, task_driver  , 0)
+        , TASK_CONFIG(1, task_burst   , 0)
+        , TASK_CONFIG(2, task_burst   , 0)
+        , TASK_CONFIG(3, task_burst   , 0)
+        , TASK_CONFIG(4, task_burst   , 0)
+        , TASK_CONFIG(5, task_burst   , 0)
+        , TASK_CONFIG(6, task_burst   , 0)
+        , TASK_CONFIG(7, task_burst   , 0)
+        , TASK_CONFIG(8, task_burst   , 0)
+        , TASK_CONFIG(9, task_shutdown, 1)
+};
+
+const Os_ResourceConfigType Os_DefaultResources[OS_RES_COUNT] = {
+        {   NAMED_INIT(priority)  OS_PRIO_COUNT
+        },
+};
+
+#if(OS_METRIC_BURST_CALLBACK)
+#define BURST_ALARM(_task)                                  \
+          { NAMED_INIT(task)     _task,                     \
+            NAMED_INIT(counter)  OS_COUNTER_BURST,          \
+            NAMED_INIT(action)   OS_ALARM_ACTION_ALARMCALLBACK, \
+            NAMED_INIT(callback) burst_callback             \
+          }
+#else
+#define BURST_ALARM(_task)                                  \
+          { NAMED_INIT(task) _task, NAMED_INIT(counter) OS_COUNTER_BURST }
+#endif
+
+const Os_AlarmConfigType Os_DefaultAlarms[OS_ALARM_COUNT] = {
+          { NAMED_INIT(task) TASK_SHUTDOWN, NAMED_INIT(counter) OS_COUNTER_SYSTEM }
+        , BURST_ALARM(1u)
+        , BURST_ALARM(2u)
+        , BURST_ALARM(3u)
+        , BURST_ALARM(4u)
+        , BURST_ALARM(5u)
+        , BURST_ALARM(6u)
+        , BURST_ALARM(7u)
+        , BURST_ALARM(8u)
+};
+
+const Os_ConfigType Os_DefaultConfig = {
+        NAMED_INIT(tasks)      &Os_DefaultTasks,
+        NAMED_INIT(resources)  &Os_DefaultResources,
+        NAMED_INIT(alarms)     &Os_DefaultAlarms,
+};
+
+int main(void)
+{
+    Os_Init(&Os_DefaultConfig);
+    Os_Start();
+    printf("Execution counts %u (bursts %u)\n"
+            , driver_count
+            , burst_count);
+    return 0;
+}
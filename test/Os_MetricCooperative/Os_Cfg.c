@@ -36,12 +36,12 @@
 #define NAMED_INIT(a) .a =
 #endif
 
-unsigned char task0_stack[512];
-unsigned char task1_stack[512];
-unsigned char task2_stack[512];
-unsigned char task3_stack[512];
-unsigned char task4_stack[512];
-unsigned char task5_stack[512];
+unsigned char task0_stack[TASK_STACK_SIZE];
+unsigned char task1_stack[TASK_STACK_SIZE];
+unsigned char task2_stack[TASK_STACK_SIZE];
+unsigned char task3_stack[TASK_STACK_SIZE];
+unsigned char task4_stack[TASK_STACK_SIZE];
+unsigned char task5_stack[TASK_STACK_SIZE];
 
 unsigned int  task0_count;
 unsigned int  task1_count;
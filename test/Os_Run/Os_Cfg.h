@@ -24,8 +24,6 @@
 #ifndef OS_CFG_H_
 #define OS_CFG_H_
 
-#include "Os_Types.h"
-
 #define OS_TASK_COUNT  (Os_TaskType)4
 #define OS_PRIO_COUNT  (Os_PriorityType)3
 #define OS_RES_COUNT   (Os_ResourceType)4
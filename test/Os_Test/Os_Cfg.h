@@ -24,12 +24,15 @@
 #ifndef OS_CFG_H_
 #define OS_CFG_H_
 
-#include "Os_Types.h"
-
 #define OS_TASK_COUNT  (Os_TaskType)4
 #define OS_PRIO_COUNT  (Os_PriorityType)OS_TASK_COUNT
 #define OS_RES_COUNT   (Os_ResourceType)5
 #define OS_ALARM_COUNT (Os_AlarmType)4
+#define OS_ISR_COUNT   (Os_IsrType)3
+
+#define OS_COUNTER_COUNT  (Os_CounterType)2
+#define OS_COUNTER_SYSTEM (Os_CounterType)0
+#define OS_COUNTER_FAST   (Os_CounterType)1
 
 #define OS_TICK_US    500000U
 
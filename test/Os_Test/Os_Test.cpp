@@ -1,6 +1,11 @@
 #include "gtest/gtest.h"
 #include <stack>
 #include <map>
+#include <ctime>
+#ifdef __linux__
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#endif
 
 extern "C" {
     #include "Std_Types.h"
@@ -34,6 +39,7 @@ template<typename T> struct Os_Test : public testing::Test {
         memset(m_tasks    , 0, sizeof(m_tasks));
         memset(m_resources, 0, sizeof(m_resources));
         memset(m_alarms   , 0, sizeof(m_alarms));
+        memset(m_isrs     , 0, sizeof(m_isrs));
         memset(m_task_activations, 0, sizeof(m_task_activations));
         for(Os_TaskType i = 0; i < OS_TASK_COUNT; ++i) {
             m_tasks[i].resource = OS_INVALID_RESOURCE;
@@ -52,6 +58,8 @@ template<typename T> struct Os_Test : public testing::Test {
         m_config.tasks     = &m_tasks;
         m_config.resources = &m_resources;
         m_config.alarms    = &m_alarms;
+        m_config.counters  = NULL;
+        m_config.isrs      = &m_isrs;
         active             = (T*)this;
     }
 
@@ -134,6 +142,7 @@ template<typename T> struct Os_Test : public testing::Test {
     Os_TaskConfigType     m_tasks    [OS_TASK_COUNT];
     Os_ResourceConfigType m_resources[OS_RES_COUNT];
     Os_AlarmConfigType    m_alarms   [OS_ALARM_COUNT];
+    Os_IsrConfigType      m_isrs     [OS_ISR_COUNT];
     Os_ConfigType         m_config;
 };
 
@@ -271,6 +280,29 @@ TEST_F(Os_Test_ResourceLockTest, Main) {
     EXPECT_EQ(m_task_activations[OS_TASK_PRIO1], 2);
 }
 
+struct Os_Test_ChainSelf : public Os_Test_Default
+{
+    virtual void task_prio0(void)
+    {
+        EXPECT_EQ(E_OK       , Os_ActivateTask(OS_TASK_PRIO1));
+        EXPECT_EQ(5          , m_task_activations[OS_TASK_PRIO1]) << "Chained task not restarted";
+        Os_Shutdown();
+    }
+
+    virtual void task_prio1(void)
+    {
+        if (m_task_activations[OS_TASK_PRIO1] < 5) {
+            Os_ChainTask(OS_TASK_PRIO1);
+        } else {
+            Os_TerminateTask();
+        }
+    }
+};
+
+TEST_F(Os_Test_ChainSelf, Main) {
+    test_main();
+}
+
 struct Os_Test_AlarmTest : public Os_Test_Default
 {
     virtual void task_prio0(void)
@@ -359,3 +391,267 @@ TEST_F(Os_Test_AlarmTest2, Main) {
     EXPECT_EQ(m_task_activations[OS_TASK_PRIO1], 1);
     EXPECT_EQ(m_task_activations[OS_TASK_PRIO2], 1);
 }
+
+struct Os_Test_CounterTimers : public Os_Test_Default
+{
+    virtual void task_prio0(void)
+    {
+        Os_GetResource(OS_RES_PRIO4);
+        EXPECT_EQ(E_OK       , Os_SetRelAlarm(0, 1, 1))              << "alarm counting fast ticks";
+        EXPECT_EQ(E_OK       , Os_SetRelAlarm(1, 2, 0))              << "alarm for shutdown";
+        Os_ReleaseResource(OS_RES_PRIO4);
+
+        while(1) {
+            /* NOP */
+        }
+    }
+
+    virtual void task_prio1(void)
+    {
+        EXPECT_EQ(E_OK       , Os_TerminateTask());
+    }
+
+    virtual void task_prio2(void)
+    {
+        Os_Shutdown();
+    }
+
+    Os_CounterConfigType m_counters[OS_COUNTER_COUNT];
+};
+
+TEST_F(Os_Test_CounterTimers, Main) {
+    /* the system counter keeps the arch timer at its default source */
+    memset(m_counters, 0, sizeof(m_counters));
+    m_counters[OS_COUNTER_FAST].source   = OS_COUNTER_SOURCE_TIMER;
+    m_counters[OS_COUNTER_FAST].period   = OS_TICK_US / 5u;
+    m_config.counters = &m_counters;
+
+    m_alarms[0].task    = OS_TASK_PRIO1;
+    m_alarms[0].counter = OS_COUNTER_FAST;
+    m_alarms[1].task    = OS_TASK_PRIO2;
+    test_main();
+
+    /* two system ticks span ten fast ticks, give or take the phase of the start */
+    EXPECT_GE(m_task_activations[OS_TASK_PRIO1], 8u);
+    EXPECT_LE(m_task_activations[OS_TASK_PRIO1], 11u);
+    EXPECT_EQ(m_task_activations[OS_TASK_PRIO2], 1);
+}
+
+
+struct Os_Test_Events : public Os_Test_Default
+{
+    virtual void task_prio0(void)
+    {
+        Os_EventMaskType mask;
+        std::clock_t     start;
+
+        EXPECT_EQ(E_OK       , Os_SetRelAlarm(0, 1, 1))              << "alarm setting tick event";
+        start = std::clock();
+        for (int i = 0; i < 3; ++i) {
+            EXPECT_EQ(E_OK   , Os_WaitEvent(0x1));
+            EXPECT_EQ(E_OK   , Os_ClearEvent(0x1));
+        }
+        /* three ticks passed waiting, nothing should have been spinning meanwhile */
+        EXPECT_LT(std::clock() - start, CLOCKS_PER_SEC * 3 * OS_TICK_US / 1000000 / 10) << "Waiting burns cpu";
+        EXPECT_EQ(E_OK       , Os_CancelAlarm(0));
+
+        /* a higher priority task sets the event and the waiting task resumes after it */
+        EXPECT_EQ(E_OK       , Os_ActivateTask(OS_TASK_PRIO1));
+        EXPECT_EQ(E_OK       , Os_WaitEvent(0x2));
+        EXPECT_EQ(E_OK       , Os_GetEvent(OS_TASK_PRIO0, &mask));
+        EXPECT_EQ(0x2        , mask);
+        EXPECT_EQ(1          , m_task_activations[OS_TASK_PRIO1]);
+
+        /* nothing sets event 0x4, the wait ends by its timeout */
+        EXPECT_EQ(E_OS_SYS_TIMEOUT, Os_WaitEventTimeout(0x4, 1));
+        EXPECT_EQ(E_OK       , Os_ActivateTask(OS_TASK_PRIO1));
+        EXPECT_EQ(E_OK       , Os_WaitEventTimeout(0x2, 100));
+        Os_Shutdown();
+    }
+
+    virtual void task_prio1(void)
+    {
+        EXPECT_EQ(E_OS_ACCESS, Os_SetEvent(OS_TASK_PRIO2, 0x2))      << "basic task";
+        EXPECT_EQ(E_OK       , Os_SetEvent(OS_TASK_PRIO0, 0x2));
+        EXPECT_EQ(E_OK       , Os_TerminateTask());
+    }
+};
+
+TEST_F(Os_Test_Events, Main) {
+    m_alarms[0].action = OS_ALARM_ACTION_SETEVENT;
+    m_alarms[0].task   = OS_TASK_PRIO0;
+    m_alarms[0].event  = 0x1;
+    m_tasks[OS_TASK_PRIO0].extended = TRUE;
+    test_main();
+    EXPECT_EQ(m_task_activations[OS_TASK_PRIO0], 1) << "Waiting task was restarted";
+}
+
+struct Os_Test_ChainSelfEvents : public Os_Test_Default
+{
+    virtual void task_prio0(void)
+    {
+        EXPECT_EQ(E_OK       , Os_ActivateTask(OS_TASK_PRIO1));
+        EXPECT_EQ(2          , m_task_activations[OS_TASK_PRIO1]) << "Chained task not restarted";
+        Os_Shutdown();
+    }
+
+    virtual void task_prio1(void)
+    {
+        Os_EventMaskType mask;
+
+        EXPECT_EQ(E_OK       , Os_GetEvent(OS_TASK_PRIO1, &mask));
+        if (m_task_activations[OS_TASK_PRIO1] < 2) {
+            EXPECT_EQ(0x0    , mask);
+            EXPECT_EQ(E_OK   , Os_SetEvent(OS_TASK_PRIO1, 0x1));
+            Os_ChainTask(OS_TASK_PRIO1);
+        } else {
+            EXPECT_EQ(0x0    , mask) << "Events kept over chaining into self";
+            Os_TerminateTask();
+        }
+    }
+};
+
+TEST_F(Os_Test_ChainSelfEvents, Main) {
+    m_tasks[OS_TASK_PRIO1].extended = TRUE;
+    test_main();
+}
+
+
+struct Os_Test_Isr : public Os_Test_Default
+{
+    static void isr0_entry(void) { static_cast<Os_Test_Isr*>(active)->isr0(); }
+    static void isr1_entry(void) { static_cast<Os_Test_Isr*>(active)->isr1(); }
+
+    void isr0(void)
+    {
+        EXPECT_EQ(1          , Os_IsrNesting);
+        EXPECT_EQ(E_OS_CALLEVEL, Os_Schedule()) << "Rescheduled from interrupt with nothing ready";
+        EXPECT_EQ(E_OK       , Os_ActivateTask(OS_TASK_PRIO2));
+        Os_Arch_RaiseIsr(1);
+        EXPECT_EQ(1          , m_isr1_count) << "Interrupt did not nest";
+        EXPECT_EQ(2          , m_isr1_nesting);
+        EXPECT_EQ(0          , m_task_activations[OS_TASK_PRIO2]) << "Task switch before outermost interrupt exit";
+    }
+
+    void isr1(void)
+    {
+        m_isr1_count++;
+        m_isr1_nesting = Os_IsrNesting;
+        EXPECT_EQ(E_OK       , Os_GetResource(OS_RES_PRIO3));
+        EXPECT_EQ(E_OK       , Os_ActivateTask(OS_TASK_PRIO1));
+        EXPECT_EQ(E_OK       , Os_ReleaseResource(OS_RES_PRIO3));
+        EXPECT_EQ(E_OS_CALLEVEL, Os_Schedule()) << "Rescheduled from interrupt";
+    }
+
+    virtual void task_prio0(void)
+    {
+        Os_IrqState state;
+
+        Os_Arch_RaiseIsr(0);
+        EXPECT_EQ(1          , m_task_activations[OS_TASK_PRIO2]);
+        EXPECT_EQ(1          , m_task_activations[OS_TASK_PRIO1]);
+        EXPECT_EQ(0          , Os_IsrNesting);
+
+        /* held off until interrupts are enabled again */
+        Os_Arch_SuspendInterrupts(&state);
+        Os_Arch_RaiseIsr(1);
+        EXPECT_EQ(1          , m_isr1_count);
+        Os_Arch_ResumeInterrupts(&state);
+        EXPECT_EQ(2          , m_isr1_count);
+        EXPECT_EQ(1          , m_isr1_nesting);
+        EXPECT_EQ(2          , m_task_activations[OS_TASK_PRIO1]);
+        Os_Shutdown();
+    }
+
+    int   m_isr1_count;
+    uint8 m_isr1_nesting;
+};
+
+TEST_F(Os_Test_Isr, Main) {
+    m_isr1_count       = 0;
+    m_isrs[0].entry    = isr0_entry;
+    m_isrs[1].entry    = isr1_entry;
+    m_isrs[1].priority = 1;
+    test_main();
+}
+
+#ifdef __linux__
+struct Os_Test_IsrFd : public Os_Test_Default
+{
+    static void isr_low_entry (void) { static_cast<Os_Test_IsrFd*>(active)->m_low++;  }
+    static void isr_high_entry(void) { static_cast<Os_Test_IsrFd*>(active)->m_high++; }
+    static void isr_fd_entry  (void) { static_cast<Os_Test_IsrFd*>(active)->isr_fd(); }
+
+    void isr_fd(void)
+    {
+        uint64_t value;
+        while (read(m_fd, &value, sizeof(value)) == sizeof(value)) {
+            m_count += value;
+        }
+        EXPECT_EQ(E_OK       , Os_SetEvent(OS_TASK_PRIO0, 0x1));
+    }
+
+    virtual void task_prio0(void)
+    {
+        Os_IrqState       state;
+        struct itimerspec period;
+        uint64_t          one = 1u;
+
+        /* eventfd written by the task itself, served through the io thread */
+        m_fd = eventfd(0, EFD_NONBLOCK);
+        ASSERT_NE(-1, m_fd);
+        EXPECT_EQ(E_OS_ID    , Os_Arch_BindIsr(OS_ISR_COUNT, m_fd)) << "Vector of invalid ID";
+        EXPECT_EQ(E_OS_VALUE , Os_Arch_BindIsr(2, -2)) << "Invalid descriptor";
+        EXPECT_EQ(E_OK       , Os_Arch_BindIsr(2, m_fd));
+        ASSERT_EQ((ssize_t)sizeof(one), write(m_fd, &one, sizeof(one)));
+        EXPECT_EQ(E_OK       , Os_WaitEventTimeout(0x1, 4)) << "Vector not raised by eventfd";
+        EXPECT_EQ(E_OK       , Os_ClearEvent(0x1));
+        EXPECT_EQ(1u         , m_count);
+        EXPECT_EQ(E_OK       , Os_Arch_BindIsr(2, -1));
+        close(m_fd);
+
+        /* periodic timerfd, each expiry raises the vector once it is read */
+        m_count = 0u;
+        m_fd    = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK);
+        ASSERT_NE(-1, m_fd);
+        memset(&period, 0, sizeof(period));
+        period.it_interval.tv_nsec = period.it_value.tv_nsec = 10000000;
+        EXPECT_EQ(0          , timerfd_settime(m_fd, 0, &period, NULL));
+        EXPECT_EQ(E_OK       , Os_Arch_BindIsr(2, m_fd));
+        while (m_count < 5u) {
+            ASSERT_EQ(E_OK   , Os_WaitEventTimeout(0x1, 4)) << "Vector not raised by timerfd";
+            EXPECT_EQ(E_OK   , Os_ClearEvent(0x1));
+        }
+        EXPECT_EQ(E_OK       , Os_Arch_BindIsr(2, -1));
+        close(m_fd);
+
+        /* masking a vector holds off those at or below its priority only */
+        Os_Arch_SuspendIsr(2, &state);
+        Os_Arch_RaiseIsr(0);
+        Os_Arch_RaiseIsr(1);
+        EXPECT_EQ(0          , m_low)  << "Masked vector served";
+        EXPECT_EQ(1          , m_high) << "Higher vector held off";
+        Os_Arch_ResumeInterrupts(&state);
+        EXPECT_EQ(1          , m_low);
+        Os_Shutdown();
+    }
+
+    int      m_fd;
+    uint64_t m_count;
+    int      m_low;
+    int      m_high;
+};
+
+TEST_F(Os_Test_IsrFd, Main) {
+    m_count            = 0u;
+    m_low              = 0;
+    m_high             = 0;
+    m_isrs[0].entry    = isr_low_entry;
+    m_isrs[1].entry    = isr_high_entry;
+    m_isrs[1].priority = 2;
+    m_isrs[2].entry    = isr_fd_entry;
+    m_isrs[2].priority = 1;
+    m_tasks[OS_TASK_PRIO0].extended = TRUE;
+    test_main();
+}
+#endif
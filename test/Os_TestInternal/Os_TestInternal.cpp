@@ -1,6 +1,7 @@
 #include "gtest/gtest.h"
 #include <stack>
 #include <map>
+#include <cstdlib>
 
 extern "C" {
     #include "Std_Types.h"
@@ -57,11 +58,23 @@ extern "C" Os_StatusType Os_Arch_Syscall(Os_SyscallParamType* param)
     return E_NOT_OK;
 }
 
+#if(OS_SYSCALL_DIRECT_ENABLE)
+extern "C" Os_StatusType Os_Arch_SyscallDirect(Os_ServiceIdType service, Os_SyscallArgType a0, Os_SyscallArgType a1, Os_SyscallArgType a2)
+{
+    return E_NOT_OK;
+}
+#endif
+
 extern "C" void Os_Arch_Start(void)
 {
 
 }
 
+extern "C" void Os_Arch_Wait(void)
+{
+
+}
+
 struct Os_TestInternal : public testing::Test {
     static Os_TestInternal* active;
 
@@ -70,6 +83,9 @@ struct Os_TestInternal : public testing::Test {
         memset(m_tasks    , 0, sizeof(m_tasks));
         memset(m_resources, 0, sizeof(m_resources));
         memset(m_alarms   , 0, sizeof(m_alarms));
+        memset(m_counters , 0, sizeof(m_counters));
+        memset(m_tables   , 0, sizeof(m_tables));
+        memset(m_isrs     , 0, sizeof(m_isrs));
         for(Os_TaskType i = 0; i < OS_TASK_COUNT; ++i) {
             m_tasks[i].priority = (Os_PriorityType)i;
             m_tasks[i].resource = OS_INVALID_RESOURCE;
@@ -83,12 +99,27 @@ struct Os_TestInternal : public testing::Test {
             m_alarms[i].task    = OS_INVALID_TASK;
             m_alarms[i].counter = OS_COUNTER_SYSTEM;
         }
+        for(Os_ScheduleTableType i = 0; i < OS_SCHEDULETABLE_COUNT; ++i) {
+            m_tables[i].counter  = OS_COUNTER_SYSTEM;
+            m_tables[i].duration = 1;
+            m_tables[i].points   = &m_point;
+            m_tables[i].count    = 1;
+        }
+        memset(&m_point, 0, sizeof(m_point));
+        for(Os_TaskGroupType i = 0; i < OS_TASKGROUP_COUNT; ++i) {
+            m_groups[i].tasks = m_members;
+            m_groups[i].count = 0;
+        }
 
         m_resources[OS_RES_SCHEDULER].priority = OS_PRIO_COUNT;
 
         m_config.tasks     = &m_tasks;
         m_config.resources = &m_resources;
         m_config.alarms    = &m_alarms;
+        m_config.counters  = &m_counters;
+        m_config.scheduletables = &m_tables;
+        m_config.taskgroups     = &m_groups;
+        m_config.isrs           = &m_isrs;
         active             = this;
     }
 
@@ -104,6 +135,12 @@ struct Os_TestInternal : public testing::Test {
     Os_TaskConfigType     m_tasks    [OS_TASK_COUNT];
     Os_ResourceConfigType m_resources[OS_RES_COUNT];
     Os_AlarmConfigType    m_alarms   [OS_ALARM_COUNT];
+    Os_CounterConfigType  m_counters [OS_COUNTER_COUNT];
+    Os_ScheduleTableConfigType m_tables[OS_SCHEDULETABLE_COUNT];
+    Os_ScheduleTableExpiryType m_point;
+    Os_TaskGroupConfigType     m_groups[OS_TASKGROUP_COUNT];
+    Os_TaskType                m_members[OS_TASK_COUNT];
+    Os_IsrConfigType           m_isrs[OS_ISR_COUNT];
     Os_ConfigType         m_config;
 };
 
@@ -198,11 +235,787 @@ TEST_F(Os_TestAlarm, CancelAlarm3) {
     EXPECT_EQ(E_OS_NOFUNC, Os_GetAlarm_Internal(2, &tick)) << "Alarm should have been cancelled";
 }
 
+TEST_F(Os_TestAlarm, CancelAlarm4) {
+    /* laid out breadth first, so adding them in order keeps the 4-ary heap as is */
+    static const Os_TickType ticks[] = { 1, 50, 10, 5, 60, 51, 52, 53, 54, 11, 12, 13, 14, 6, 7, 8 };
+    Os_CounterControlType*   control = &Os_CounterControls[OS_COUNTER_SYSTEM];
+    Os_AlarmType             alarm;
+    Os_TickType              prev    = 0;
+
+    for (alarm = 0; alarm < 16; ++alarm) {
+        EXPECT_EQ(E_OK   , Os_SetAbsAlarm_Internal(alarm, ticks[alarm], 0));
+    }
+
+    /* last entry moves in below a later parent and must bubble up */
+    EXPECT_EQ(E_OK       , Os_CancelAlarm_Internal(5));
+    EXPECT_EQ(15         , control->count);
+#if(OS_ALARM_HEAP_ARITY == 4u)
+    EXPECT_EQ(1          , Os_AlarmControls[15].index) << "Moved in entry did not bubble up";
+#endif
+
+    for (Os_AlarmQueueIndexType index = 0; index < control->count; ++index) {
+        EXPECT_EQ(index  , Os_AlarmControls[control->queue[index].alarm].index) << "Back index out of sync";
+        EXPECT_EQ(Os_AlarmControls[control->queue[index].alarm].ticks, control->queue[index].tick) << "Heap key out of sync";
+        if (index > 0) {
+            EXPECT_TRUE(Os_TickLessThan(control->queue[Os_AlarmHeapParent(index)].tick, control->queue[index].tick)) << "Heap order broken";
+        }
+    }
+
+    while (control->count) {
+        Os_AlarmPop(control, &alarm);
+        EXPECT_LE(prev   , Os_AlarmControls[alarm].ticks) << "Alarms popped out of order";
+        prev = Os_AlarmControls[alarm].ticks;
+    }
+
+    EXPECT_EQ(E_OK       , Os_SetAbsAlarm_Internal(5, 5, 0)) << "Cancelled alarm could not be set again";
+}
+
 TEST_F(Os_TestAlarm, GetAlarm1) {
     Os_TickType tick;
     EXPECT_EQ(E_OS_ID    , Os_GetAlarm_Internal(OS_ALARM_COUNT, &tick)) << "Alarm of invalid ID";
 }
 
+TEST_F(Os_TestAlarm, SetRelAlarms1) {
+    Os_AlarmSetType invalid[]   = { { 0, 5, 0 }, { 1, 5, 0 }, { OS_ALARM_COUNT, 5, 0 } };
+    Os_AlarmSetType twice[]     = { { 0, 5, 0 }, { 1, 5, 0 }, { 0, 7, 0 } };
+    Os_AlarmSetType zero[]      = { { 0, 5, 0 }, { 1, 0, 0 } };
+    Os_AlarmSetType used[]      = { { 1, 5, 0 }, { 2, 5, 0 } };
+    Os_TickType     tick;
+
+    EXPECT_EQ(E_OS_ID    , Os_SetRelAlarms_Internal(invalid, 3)) << "Alarm of invalid ID";
+    EXPECT_EQ(E_OS_STATE , Os_SetRelAlarms_Internal(twice  , 3)) << "Alarm listed twice";
+    EXPECT_EQ(E_OS_VALUE , Os_SetRelAlarms_Internal(zero   , 2)) << "Zero increment";
+    EXPECT_EQ(E_OS_VALUE , Os_SetRelAlarms_Internal(used   , OS_ALARM_COUNT + 1)) << "More entries than alarms";
+    EXPECT_EQ(0          , Os_CounterControls[OS_COUNTER_SYSTEM].count) << "Rejected batch armed alarms";
+
+    EXPECT_EQ(E_OK       , Os_SetRelAlarm_Internal(2, 1, 0));
+    EXPECT_EQ(E_OS_STATE , Os_SetRelAlarms_Internal(used   , 2)) << "Alarm already in use";
+    EXPECT_EQ(E_OS_NOFUNC, Os_GetAlarm_Internal(1, &tick)) << "Alarm before the rejected one stayed armed";
+    EXPECT_EQ(E_OK       , Os_SetRelAlarms_Internal(used   , 0)) << "Empty batch";
+}
+
+TEST_F(Os_TestAlarm, SetRelAlarms2) {
+    Os_CounterControlType* control = &Os_CounterControls[OS_COUNTER_SYSTEM];
+    Os_AlarmSetType        batch[OS_ALARM_COUNT];
+    Os_AlarmType           alarm;
+    Os_TickType            prev;
+
+    /* small batch onto a larger heap is sifted in, large batch onto a small heap rebuilds it */
+    for (Os_AlarmType split = 0; split <= OS_ALARM_COUNT; split += OS_ALARM_COUNT / 4) {
+        for (alarm = 0; alarm < split; ++alarm) {
+            EXPECT_EQ(E_OK   , Os_SetRelAlarm_Internal(alarm, (Os_TickType)((alarm * 7u) % 23u + 1u), 0));
+        }
+        for (alarm = split; alarm < OS_ALARM_COUNT; ++alarm) {
+            batch[alarm - split].alarm     = alarm;
+            batch[alarm - split].increment = (Os_TickType)((alarm * 11u) % 19u + 1u);
+            batch[alarm - split].cycle     = 0;
+        }
+        EXPECT_EQ(E_OK   , Os_SetRelAlarms_Internal(batch, OS_ALARM_COUNT - split));
+        EXPECT_EQ(OS_ALARM_COUNT, control->count);
+
+        for (Os_AlarmQueueIndexType index = 0; index < control->count; ++index) {
+            EXPECT_EQ(index  , Os_AlarmControls[control->queue[index].alarm].index) << "Back index out of sync";
+            if (index > 0) {
+                EXPECT_TRUE(Os_TickLessThan(control->queue[Os_AlarmHeapParent(index)].tick, control->queue[index].tick)) << "Heap order broken";
+            }
+        }
+
+        prev = 0;
+        while (control->count) {
+            Os_AlarmPop(control, &alarm);
+            EXPECT_LE(prev, Os_AlarmControls[alarm].ticks) << "Alarms popped out of order";
+            prev = Os_AlarmControls[alarm].ticks;
+        }
+    }
+}
+
+static unsigned int   Os_TestCallbackCount;
+static Os_ContextType Os_TestCallbackContext;
+static Os_StatusType  Os_TestCallbackStatus;
+
+static void Os_TestCallback(void)
+{
+    Os_SyscallParamType param;
+    param.service = OSServiceId_ActivateTask;
+    param.p1.task = 0;
+
+    Os_TestCallbackCount++;
+    Os_TestCallbackContext = Os_CallContext;
+    Os_TestCallbackStatus  = Os_Syscall_Internal(&param);
+}
+
+TEST_F(Os_TestAlarm, AlarmCallback1) {
+    Os_TestCallbackCount   = 0;
+    Os_TestCallbackContext = OS_CONTEXT_NONE;
+    Os_TestCallbackStatus  = E_OK;
+    m_alarms[0].action     = OS_ALARM_ACTION_ALARMCALLBACK;
+    m_alarms[0].callback   = Os_TestCallback;
+    m_alarms[0].task       = 0;
+
+    Os_CallContext = OS_CONTEXT_TASK;
+    EXPECT_EQ(E_OK       , Os_SetRelAlarm_Internal(0, 2, 2));
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(E_OK   , Os_IncrementCounter_Internal(OS_COUNTER_SYSTEM));
+    }
+
+    EXPECT_EQ(2                       , Os_TestCallbackCount);
+    EXPECT_EQ(OS_CONTEXT_ALARMCALLBACK, Os_TestCallbackContext);
+    EXPECT_EQ(E_OS_CALLEVEL           , Os_TestCallbackStatus) << "Service allowed from alarm callback";
+    ASSERT_FALSE(Os_Errors.empty());
+    EXPECT_EQ(E_OS_CALLEVEL           , Os_Errors.top());
+    EXPECT_EQ(OS_CONTEXT_TASK         , Os_CallContext) << "Call context not restored";
+    EXPECT_EQ(OS_TASK_SUSPENDED       , Os_TaskControls[0].state) << "Callback alarm activated its task";
+}
+
+/* upper half of the alarms run on a wheel counter, lower half mirror them on the heap */
+#define OS_TEST_WHEEL_ALARMS (Os_AlarmType)(OS_ALARM_COUNT / 2)
+
+struct Os_TestAlarmWheel : public Os_TestInternal
+{
+    virtual void SetUp()
+    {
+        Os_TestInternal::SetUp();
+        m_counters[OS_COUNTER_WHEEL].queue = OS_COUNTER_QUEUE_WHEEL;
+        for(Os_AlarmType i = OS_TEST_WHEEL_ALARMS; i < OS_ALARM_COUNT; ++i) {
+            m_alarms[i].counter = OS_COUNTER_WHEEL;
+        }
+        Os_Init(&m_config);
+    }
+
+    void SetTicks(Os_TickType ticks)
+    {
+        Os_CounterControls[OS_COUNTER_SYSTEM].ticks = ticks;
+        Os_CounterControls[OS_COUNTER_WHEEL].ticks  = ticks;
+    }
+
+    void Tick()
+    {
+        EXPECT_EQ(E_OK, Os_IncrementCounter_Internal(OS_COUNTER_SYSTEM));
+        EXPECT_EQ(E_OK, Os_IncrementCounter_Internal(OS_COUNTER_WHEEL));
+    }
+};
+
+TEST_F(Os_TestAlarmWheel, QueueLayout1) {
+    /* schedule tables and task timeouts queue one alarm each on the system counter */
+    EXPECT_EQ(OS_TEST_WHEEL_ALARMS + OS_SCHEDULETABLE_COUNT + OS_TASK_COUNT, Os_CounterControls[OS_COUNTER_SYSTEM].size);
+    EXPECT_EQ(OS_ALARM_COUNT - OS_TEST_WHEEL_ALARMS                        , Os_CounterControls[OS_COUNTER_WHEEL].size);
+    EXPECT_EQ(&Os_AlarmQueuePool[0]                                                           , Os_CounterControls[OS_COUNTER_SYSTEM].queue);
+    EXPECT_EQ(&Os_AlarmQueuePool[OS_TEST_WHEEL_ALARMS + OS_SCHEDULETABLE_COUNT + OS_TASK_COUNT], Os_CounterControls[OS_COUNTER_WHEEL].queue) << "Queues of counters overlap";
+}
+
+TEST_F(Os_TestAlarmWheel, Expiry1) {
+    static const Os_TickType increments[] = { 1, 17, 0x110, 0x8000 };
+    Os_TickType              start        = 0xfff0;
+    Os_TickType              expired[4]   = { 0 };
+    Os_TickType              tick;
+    uint32                   step;
+
+    SetTicks(start);
+    for (Os_AlarmType i = 0; i < 4; ++i) {
+        EXPECT_EQ(E_OK   , Os_SetRelAlarm_Internal(OS_TEST_WHEEL_ALARMS + i, increments[i], 0));
+        EXPECT_EQ(E_OK   , Os_GetAlarm_Internal(OS_TEST_WHEEL_ALARMS + i, &tick));
+        EXPECT_EQ(increments[i], tick);
+    }
+
+    for (step = 1; step <= 0x8000; ++step) {
+        Tick();
+        for (Os_AlarmType i = 0; i < 4; ++i) {
+            if (!expired[i] && !Os_AlarmControls[OS_TEST_WHEEL_ALARMS + i].queued) {
+                expired[i] = (Os_TickType)step;
+            }
+        }
+    }
+
+    for (Os_AlarmType i = 0; i < 4; ++i) {
+        EXPECT_EQ(increments[i], expired[i]) << "Alarm " << (int)i << " expired at wrong tick";
+    }
+}
+
+TEST_F(Os_TestAlarmWheel, SetAbsAlarm1) {
+    SetTicks(0x1234);
+    EXPECT_EQ(E_OK       , Os_SetAbsAlarm_Internal(OS_TEST_WHEEL_ALARMS + 0, 0x1234, 0));
+    EXPECT_EQ(E_OK       , Os_SetAbsAlarm_Internal(OS_TEST_WHEEL_ALARMS + 1, 0x1000, 0));
+    EXPECT_EQ(E_OK       , Os_SetAbsAlarm_Internal(OS_TEST_WHEEL_ALARMS + 2, 0x1300, 0));
+
+    Tick();
+    EXPECT_FALSE(Os_AlarmControls[OS_TEST_WHEEL_ALARMS + 0].queued) << "Alarm at current tick should expire on next tick";
+    EXPECT_FALSE(Os_AlarmControls[OS_TEST_WHEEL_ALARMS + 1].queued) << "Alarm in the past should expire on next tick";
+    EXPECT_TRUE (Os_AlarmControls[OS_TEST_WHEEL_ALARMS + 2].queued);
+}
+
+TEST_F(Os_TestAlarmWheel, CancelAlarm1) {
+    Os_TickType tick;
+    for (Os_AlarmType i = OS_TEST_WHEEL_ALARMS; i < OS_ALARM_COUNT; ++i) {
+        EXPECT_EQ(E_OK   , Os_SetRelAlarm_Internal(i, 40, 0));
+    }
+
+    /* all share one slot, remove from the middle and from the head */
+    EXPECT_EQ(E_OK       , Os_CancelAlarm_Internal(OS_TEST_WHEEL_ALARMS + 1));
+    EXPECT_EQ(E_OK       , Os_CancelAlarm_Internal(OS_ALARM_COUNT - 1));
+    EXPECT_EQ(E_OS_NOFUNC, Os_CancelAlarm_Internal(OS_TEST_WHEEL_ALARMS + 1)) << "Already canceled this alarm";
+    EXPECT_EQ(E_OS_NOFUNC, Os_GetAlarm_Internal(OS_TEST_WHEEL_ALARMS + 1, &tick)) << "Alarm should have been cancelled";
+
+    for (tick = 0; tick < 40; ++tick) {
+        Tick();
+    }
+    for (Os_AlarmType i = OS_TEST_WHEEL_ALARMS; i < OS_ALARM_COUNT; ++i) {
+        EXPECT_FALSE(Os_AlarmControls[i].queued);
+    }
+
+    EXPECT_EQ(E_OK       , Os_SetRelAlarm_Internal(OS_TEST_WHEEL_ALARMS + 1, 5, 0)) << "Cancelled alarm could not be set again";
+}
+
+TEST_F(Os_TestAlarmWheel, AdvanceCounter1) {
+    Os_TickType tick;
+    EXPECT_EQ(E_OS_VALUE , Os_AdvanceCounter_Internal(OS_COUNTER_COUNT, 1)) << "Counter of invalid ID";
+    EXPECT_EQ(E_OS_VALUE , Os_AdvanceCounter_Internal(OS_COUNTER_SYSTEM, 0)) << "Zero ticks";
+
+    for (Os_AlarmType base = 0; base < OS_ALARM_COUNT; base += OS_TEST_WHEEL_ALARMS) {
+        Os_CounterType counter = m_alarms[base].counter;
+        EXPECT_EQ(E_OK   , Os_SetAbsAlarm_Internal(base + 0, 5, 3));
+        EXPECT_EQ(E_OK   , Os_SetRelAlarm_Internal(base + 1, 7, 0));
+        EXPECT_EQ(E_OK   , Os_SetRelAlarm_Internal(base + 2, 21, 0));
+
+        /* cyclic alarm expires at 5, 8, 11, 14, 17 and 20 within one call */
+        EXPECT_EQ(E_OK   , Os_AdvanceCounter_Internal(counter, 20));
+        EXPECT_EQ(20     , Os_CounterControls[counter].ticks);
+        EXPECT_EQ(23     , Os_AlarmControls[base + 0].ticks);
+        EXPECT_EQ(E_OK   , Os_GetAlarm_Internal(base + 0, &tick));
+        EXPECT_EQ(3      , tick);
+        EXPECT_FALSE(Os_AlarmControls[base + 1].queued) << "Alarm inside window did not expire";
+        EXPECT_TRUE (Os_AlarmControls[base + 2].queued) << "Alarm after window expired";
+    }
+}
+
+TEST_F(Os_TestAlarmWheel, SetRelAlarms1) {
+    Os_AlarmSetType batch[OS_ALARM_COUNT];
+
+    SetTicks(0xfffa);
+    for (Os_AlarmType i = 0; i < OS_TEST_WHEEL_ALARMS; ++i) {
+        batch[2 * i + 0].alarm     = i;
+        batch[2 * i + 1].alarm     = OS_TEST_WHEEL_ALARMS + i;
+        batch[2 * i + 0].increment = batch[2 * i + 1].increment = (Os_TickType)(i * 3u + 1u);
+        batch[2 * i + 0].cycle     = batch[2 * i + 1].cycle     = (Os_TickType)(i % 3u);
+    }
+    EXPECT_EQ(E_OK       , Os_SetRelAlarms_Internal(batch, OS_ALARM_COUNT));
+
+    for (Os_TickType step = 0; step < 64; ++step) {
+        Tick();
+        for (Os_AlarmType i = 0; i < OS_TEST_WHEEL_ALARMS; ++i) {
+            EXPECT_EQ(Os_AlarmControls[i].queued, Os_AlarmControls[OS_TEST_WHEEL_ALARMS + i].queued) << "Alarm " << (int)i << " differs at step " << (int)step;
+            EXPECT_EQ(Os_AlarmControls[i].ticks , Os_AlarmControls[OS_TEST_WHEEL_ALARMS + i].ticks);
+        }
+    }
+}
+
+TEST_F(Os_TestAlarmWheel, HeapEquivalence1) {
+    std::srand(1);
+    SetTicks(0xf000);
+    for (uint32 step = 0; step < 200000; ++step) {
+        Os_AlarmType alarm  = (Os_AlarmType)(std::rand() % OS_TEST_WHEEL_ALARMS);
+        Os_TickType  now    = Os_CounterControls[OS_COUNTER_SYSTEM].ticks;
+        Os_TickType  value  = (Os_TickType)(std::rand() % 0x3000 + 1);
+        Os_TickType  cycle  = (std::rand() % 4) ? 0 : (Os_TickType)(std::rand() % 0x200 + 1);
+
+        switch (std::rand() % 8) {
+            case 0:
+                EXPECT_EQ(Os_SetRelAlarm_Internal(alarm, value, cycle)
+                        , Os_SetRelAlarm_Internal(OS_TEST_WHEEL_ALARMS + alarm, value, cycle));
+                break;
+            case 1:
+                value = (Os_TickType)(now + value - 0x1000);
+                EXPECT_EQ(Os_SetAbsAlarm_Internal(alarm, value, cycle)
+                        , Os_SetAbsAlarm_Internal(OS_TEST_WHEEL_ALARMS + alarm, value, cycle));
+                break;
+            case 2:
+                EXPECT_EQ(Os_CancelAlarm_Internal(alarm)
+                        , Os_CancelAlarm_Internal(OS_TEST_WHEEL_ALARMS + alarm));
+                break;
+            case 3:
+                value = (Os_TickType)(value % 0x40 + 1);
+                EXPECT_EQ(E_OK, Os_AdvanceCounter_Internal(OS_COUNTER_SYSTEM, value));
+                EXPECT_EQ(E_OK, Os_AdvanceCounter_Internal(OS_COUNTER_WHEEL , value));
+                break;
+            default:
+                Tick();
+                break;
+        }
+
+        for (alarm = 0; alarm < OS_TEST_WHEEL_ALARMS; ++alarm) {
+            ASSERT_EQ(Os_AlarmControls[alarm].queued, Os_AlarmControls[OS_TEST_WHEEL_ALARMS + alarm].queued) << "Expiry differs at step " << step;
+            ASSERT_EQ(Os_AlarmControls[alarm].ticks, Os_AlarmControls[OS_TEST_WHEEL_ALARMS + alarm].ticks) << "Cycle differs at step " << step;
+        }
+    }
+}
+
+
+static const Os_TaskType                Os_TestTableTasks[] = { 0, 1, 2 };
+static const Os_ScheduleTableExpiryType Os_TestTablePoints[] = {
+    { 0, &Os_TestTableTasks[0], 1 },
+    { 2, &Os_TestTableTasks[1], 1 },
+    { 5, &Os_TestTableTasks[0], 2 },
+};
+static const Os_ScheduleTableExpiryType Os_TestTableSingle[] = {
+    { 1, &Os_TestTableTasks[2], 1 },
+};
+
+/* table 0 and 2 run the same repeating points on the heap and the wheel, table 1 runs once */
+struct Os_TestScheduleTable : public Os_TestInternal
+{
+    virtual void SetUp()
+    {
+        Os_TestInternal::SetUp();
+        for(Os_TaskType i = 0; i < OS_TASK_COUNT; ++i) {
+            m_tasks[i].activation = 255;
+        }
+        m_counters[OS_COUNTER_WHEEL].queue = OS_COUNTER_QUEUE_WHEEL;
+
+        m_tables[0].counter   = OS_COUNTER_SYSTEM;
+        m_tables[0].duration  = 8;
+        m_tables[0].repeating = TRUE;
+        m_tables[0].points    = Os_TestTablePoints;
+        m_tables[0].count     = 3;
+
+        m_tables[1].counter   = OS_COUNTER_SYSTEM;
+        m_tables[1].duration  = 3;
+        m_tables[1].repeating = FALSE;
+        m_tables[1].points    = Os_TestTableSingle;
+        m_tables[1].count     = 1;
+
+        m_tables[2]           = m_tables[0];
+        m_tables[2].counter   = OS_COUNTER_WHEEL;
+        Os_Init(&m_config);
+    }
+
+    Os_ScheduleTableStatusType Status(Os_ScheduleTableType table)
+    {
+        Os_ScheduleTableStatusType status = OS_SCHEDULETABLE_STOPPED;
+        EXPECT_EQ(E_OK, Os_GetScheduleTableStatus_Internal(table, &status));
+        return status;
+    }
+
+    void Tick(Os_TickType ticks)
+    {
+        for (; ticks > 0; --ticks) {
+            EXPECT_EQ(E_OK, Os_IncrementCounter_Internal(OS_COUNTER_SYSTEM));
+        }
+    }
+};
+
+TEST_F(Os_TestScheduleTable, StartScheduleTable1) {
+    EXPECT_EQ(E_OS_ID    , Os_StartScheduleTableRel_Internal(OS_SCHEDULETABLE_COUNT, 1)) << "Table of invalid ID";
+    EXPECT_EQ(E_OS_ID    , Os_StartScheduleTableAbs_Internal(OS_SCHEDULETABLE_COUNT, 1)) << "Table of invalid ID";
+    EXPECT_EQ(E_OS_VALUE , Os_StartScheduleTableRel_Internal(0, 0)) << "Zero offset";
+    EXPECT_EQ(OS_SCHEDULETABLE_STOPPED, Status(0));
+
+    EXPECT_EQ(E_OK       , Os_StartScheduleTableRel_Internal(0, 1));
+    EXPECT_EQ(OS_SCHEDULETABLE_RUNNING, Status(0));
+    EXPECT_EQ(E_OS_STATE , Os_StartScheduleTableRel_Internal(0, 1)) << "Table already running";
+    EXPECT_EQ(E_OS_STATE , Os_StartScheduleTableAbs_Internal(0, 1)) << "Table already running";
+    EXPECT_EQ(1          , Os_CounterControls[OS_COUNTER_SYSTEM].count) << "Running table should queue one alarm";
+
+    EXPECT_EQ(E_OK       , Os_StopScheduleTable_Internal(0));
+    EXPECT_EQ(OS_SCHEDULETABLE_STOPPED, Status(0));
+    EXPECT_EQ(0          , Os_CounterControls[OS_COUNTER_SYSTEM].count);
+    EXPECT_EQ(E_OS_NOFUNC, Os_StopScheduleTable_Internal(0)) << "Table already stopped";
+    EXPECT_EQ(E_OS_ID    , Os_StopScheduleTable_Internal(OS_SCHEDULETABLE_COUNT)) << "Table of invalid ID";
+
+    Tick(10);
+    EXPECT_EQ(0          , Os_TaskControls[0].activation) << "Stopped table activated task";
+
+    EXPECT_EQ(E_OK       , Os_StartScheduleTableAbs_Internal(1, 12));
+    Tick(2);
+    EXPECT_EQ(0          , Os_TaskControls[2].activation);
+    Tick(1);
+    EXPECT_EQ(1          , Os_TaskControls[2].activation) << "Expiry point not at start plus offset";
+    Tick(1);
+    EXPECT_EQ(OS_SCHEDULETABLE_RUNNING, Status(1)) << "Table stopped before its final delay";
+    Tick(1);
+    EXPECT_EQ(OS_SCHEDULETABLE_STOPPED, Status(1)) << "Single shot table not stopped after its duration";
+    EXPECT_EQ(0          , Os_CounterControls[OS_COUNTER_SYSTEM].count);
+}
+
+TEST_F(Os_TestScheduleTable, Config1) {
+    static const Os_ScheduleTableExpiryType repeated[] = {
+        { 1, &Os_TestTableTasks[0], 1 },
+        { 1, &Os_TestTableTasks[1], 1 },
+    };
+
+    EXPECT_TRUE(Os_Errors.empty()) << "Valid tables rejected";
+
+    m_tables[1].count     = 0;
+    Os_Init(&m_config);
+    ASSERT_FALSE(Os_Errors.empty());
+    EXPECT_EQ(E_OS_VALUE , Os_Errors.top()) << "Table without expiry points accepted";
+    Os_Errors.pop();
+
+    m_tables[1].points    = repeated;
+    m_tables[1].count     = 2;
+    Os_Init(&m_config);
+    ASSERT_FALSE(Os_Errors.empty());
+    EXPECT_EQ(E_OS_VALUE , Os_Errors.top()) << "Offsets not strictly increasing accepted";
+    Os_Errors.pop();
+
+    m_tables[1].points    = Os_TestTableSingle;
+    m_tables[1].count     = 1;
+    m_tables[1].duration  = 1;
+    Os_Init(&m_config);
+    ASSERT_FALSE(Os_Errors.empty());
+    EXPECT_EQ(E_OS_VALUE , Os_Errors.top()) << "Duration not past the last offset accepted";
+    Os_Errors.pop();
+
+    m_tables[1].duration  = 2;
+    Os_Init(&m_config);
+    EXPECT_TRUE(Os_Errors.empty()) << "Valid tables rejected";
+}
+
+TEST_F(Os_TestScheduleTable, Expiry1) {
+    /* rounds start at 1, 9, 17 with points on offset 0, 2 and 5 */
+    static const uint8 activations[][2] = {
+        {0, 0}, {1, 0}, {1, 0}, {1, 1}, {1, 1}, {1, 1}, {2, 2}, {2, 2}, {2, 2},
+        {3, 2}, {3, 2}, {3, 3}, {3, 3}, {3, 3}, {4, 4}, {4, 4}, {4, 4}, {5, 4},
+    };
+
+    EXPECT_EQ(E_OK       , Os_StartScheduleTableRel_Internal(0, 1));
+    for (unsigned int tick = 0; tick < sizeof(activations) / sizeof(activations[0]); ++tick) {
+        EXPECT_EQ(activations[tick][0], Os_TaskControls[0].activation) << "Tick " << tick;
+        EXPECT_EQ(activations[tick][1], Os_TaskControls[1].activation) << "Tick " << tick;
+        EXPECT_EQ(1                   , Os_CounterControls[OS_COUNTER_SYSTEM].count) << "Tick " << tick;
+        Tick(1);
+    }
+}
+
+TEST_F(Os_TestScheduleTable, NextScheduleTable1) {
+    Os_SyscallParamType param;
+
+    EXPECT_EQ(E_OS_ID    , Os_NextScheduleTable_Internal(OS_SCHEDULETABLE_COUNT, 0)) << "Table of invalid ID";
+    EXPECT_EQ(E_OS_ID    , Os_NextScheduleTable_Internal(0, OS_SCHEDULETABLE_COUNT)) << "Table of invalid ID";
+    EXPECT_EQ(E_OS_ID    , Os_NextScheduleTable_Internal(1, 2)) << "Tables on different counters";
+    EXPECT_EQ(E_OS_NOFUNC, Os_NextScheduleTable_Internal(1, 0)) << "Table not running";
+
+    EXPECT_EQ(E_OK       , Os_StartScheduleTableRel_Internal(1, 1));
+    EXPECT_EQ(E_OS_STATE , Os_NextScheduleTable_Internal(1, 1)) << "Next table not stopped";
+    EXPECT_EQ(E_OK       , Os_NextScheduleTable_Internal(1, 0));
+    EXPECT_EQ(OS_SCHEDULETABLE_NEXT, Status(0));
+
+    /* a stopped next table is unlinked from the running one */
+    EXPECT_EQ(E_OK       , Os_StopScheduleTable_Internal(0));
+    EXPECT_EQ(OS_INVALID_SCHEDULETABLE, Os_ScheduleTableControls[1].next);
+    EXPECT_EQ(E_OK       , Os_NextScheduleTable_Internal(1, 0));
+
+    /* table 1 expires at 2 and ends at 4, where table 0 takes over with its point at offset 0 */
+    Tick(3);
+    EXPECT_EQ(1          , Os_TaskControls[2].activation);
+    EXPECT_EQ(OS_SCHEDULETABLE_NEXT   , Status(0));
+    Tick(1);
+    EXPECT_EQ(OS_SCHEDULETABLE_STOPPED, Status(1));
+    EXPECT_EQ(OS_SCHEDULETABLE_RUNNING, Status(0));
+    EXPECT_EQ(1          , Os_TaskControls[0].activation) << "First point of next table not on the hand over tick";
+    Tick(2);
+    EXPECT_EQ(1          , Os_TaskControls[1].activation);
+    EXPECT_EQ(1          , Os_CounterControls[OS_COUNTER_SYSTEM].count);
+
+    /* stopping a running table stops the table queued after it */
+    EXPECT_EQ(E_OK       , Os_NextScheduleTable_Internal(0, 1));
+    param.service = OSServiceId_StopScheduleTable;
+    param.p1.table = 0;
+    EXPECT_EQ(E_OK       , Os_Syscall_Internal(&param));
+    EXPECT_EQ(OS_SCHEDULETABLE_STOPPED, Status(0));
+    EXPECT_EQ(OS_SCHEDULETABLE_STOPPED, Status(1));
+    EXPECT_EQ(0          , Os_CounterControls[OS_COUNTER_SYSTEM].count);
+}
+
+TEST_F(Os_TestScheduleTable, WheelEquivalence1) {
+    std::srand(2);
+    EXPECT_EQ(E_OK       , Os_StartScheduleTableRel_Internal(0, 3));
+    EXPECT_EQ(E_OK       , Os_StartScheduleTableRel_Internal(2, 3));
+    for (uint32 step = 0; step < 10000; ++step) {
+        Os_TickType ticks = (Os_TickType)(std::rand() % 20 + 1);
+        EXPECT_EQ(E_OK, Os_AdvanceCounter_Internal(OS_COUNTER_SYSTEM, ticks));
+        EXPECT_EQ(E_OK, Os_AdvanceCounter_Internal(OS_COUNTER_WHEEL , ticks));
+        ASSERT_EQ(Os_ScheduleTableControls[0].point, Os_ScheduleTableControls[2].point) << "Expiry differs at step " << step;
+        ASSERT_EQ(Os_AlarmControls[OS_ALARM_COUNT + 0].ticks, Os_AlarmControls[OS_ALARM_COUNT + 2].ticks) << "Expiry differs at step " << step;
+    }
+}
+
+
+struct Os_TestEvent : public Os_TestInternal
+{
+    virtual void SetUp()
+    {
+        Os_TestInternal::SetUp();
+        for(Os_TaskType i = 0; i < OS_TASK_COUNT; ++i) {
+            m_tasks[i].activation = 1;
+        }
+        m_tasks[1].extended = TRUE;
+        m_tasks[2].extended = TRUE;
+        Os_Init(&m_config);
+        Os_ActiveTask  = 0;
+        Os_CallContext = OS_CONTEXT_TASK;
+    }
+
+    void Run(Os_TaskType task)
+    {
+        EXPECT_EQ(E_OK, Os_Schedule_Internal());
+        EXPECT_EQ(task, Os_ActiveTask);
+        EXPECT_EQ(OS_TASK_RUNNING, Os_TaskControls[task].state);
+    }
+};
+
+TEST_F(Os_TestEvent, SetEvent1) {
+    Os_EventMaskType mask;
+
+    EXPECT_EQ(E_OS_ID    , Os_SetEvent_Internal(OS_TASK_COUNT, 1)) << "Task of invalid ID";
+    EXPECT_EQ(E_OS_ACCESS, Os_SetEvent_Internal(0, 1))             << "Basic task";
+    EXPECT_EQ(E_OS_STATE , Os_SetEvent_Internal(1, 1))             << "Suspended task";
+    EXPECT_EQ(E_OS_ID    , Os_GetEvent_Internal(OS_TASK_COUNT, &mask)) << "Task of invalid ID";
+    EXPECT_EQ(E_OS_ACCESS, Os_GetEvent_Internal(0, &mask))         << "Basic task";
+    EXPECT_EQ(E_OS_STATE , Os_GetEvent_Internal(1, &mask))         << "Suspended task";
+
+    EXPECT_EQ(E_OK       , Os_ActivateTask_Internal(1));
+    EXPECT_EQ(E_OK       , Os_SetEvent_Internal(1, 0x5));
+    EXPECT_EQ(E_OK       , Os_GetEvent_Internal(1, &mask));
+    EXPECT_EQ(0x5        , mask);
+    EXPECT_EQ(OS_TASK_READY_FIRST, Os_TaskControls[1].state) << "Ready task changed state";
+
+    Run(1);
+    EXPECT_EQ(E_OK       , Os_ClearEvent_Internal(0x1));
+    EXPECT_EQ(E_OK       , Os_GetEvent_Internal(1, &mask));
+    EXPECT_EQ(0x4        , mask);
+
+    /* events are cleared when the task is activated again */
+    EXPECT_EQ(E_OK       , Os_TerminateTask_Internal());
+    EXPECT_EQ(E_OK       , Os_ActivateTask_Internal(1));
+    EXPECT_EQ(E_OK       , Os_GetEvent_Internal(1, &mask));
+    EXPECT_EQ(0x0        , mask);
+}
+
+TEST_F(Os_TestEvent, WaitEvent1) {
+    Os_EventMaskType mask;
+
+    EXPECT_EQ(E_OK       , Os_ActivateTask_Internal(0));
+    Run(0);
+    EXPECT_EQ(E_OS_ACCESS, Os_WaitEvent_Internal(0x1)) << "Basic task";
+    EXPECT_EQ(E_OS_ACCESS, Os_ClearEvent_Internal(0x1)) << "Basic task";
+
+    EXPECT_EQ(E_OK       , Os_ActivateTask_Internal(1));
+    Run(1);
+    EXPECT_EQ(OS_TASK_READY, Os_TaskControls[0].state);
+
+    EXPECT_EQ(E_OK       , Os_GetResource_Internal(OS_RES_SCHEDULER));
+    EXPECT_EQ(E_OS_RESOURCE, Os_WaitEvent_Internal(0x1)) << "Waiting with a resource held";
+    EXPECT_EQ(E_OK       , Os_ReleaseResource_Internal(OS_RES_SCHEDULER));
+    Os_CallContext = OS_CONTEXT_ISR2;
+    EXPECT_EQ(E_OS_CALLEVEL, Os_WaitEvent_Internal(0x1)) << "Waiting from interrupt";
+    EXPECT_EQ(E_OS_CALLEVEL, Os_ClearEvent_Internal(0x1)) << "Clearing from interrupt";
+    Os_CallContext = OS_CONTEXT_TASK;
+
+    /* an event already set returns at once */
+    EXPECT_EQ(E_OK       , Os_SetEvent_Internal(1, 0x2));
+    Os_DispatchPending = FALSE;
+    EXPECT_EQ(E_OK       , Os_WaitEvent_Internal(0x3));
+    EXPECT_EQ(OS_TASK_RUNNING, Os_TaskControls[1].state);
+    EXPECT_FALSE(Os_DispatchPending) << "Dispatch requested without waiting";
+    EXPECT_EQ(E_OK       , Os_ClearEvent_Internal(0x2));
+
+    /* the waiting task leaves the cpu to the lower priority one */
+    EXPECT_EQ(E_OK       , Os_WaitEvent_Internal(0x1));
+    EXPECT_EQ(OS_TASK_WAITING, Os_TaskControls[1].state);
+    EXPECT_TRUE(Os_DispatchPending);
+    Run(0);
+
+    EXPECT_EQ(E_OK       , Os_SetEvent_Internal(1, 0x2));
+    EXPECT_EQ(OS_TASK_WAITING, Os_TaskControls[1].state) << "Woken by an event not waited for";
+    EXPECT_EQ(E_OK       , Os_GetEvent_Internal(1, &mask));
+    EXPECT_EQ(0x2        , mask);
+
+    Os_DispatchPending = FALSE;
+    EXPECT_EQ(E_OK       , Os_SetEvent_Internal(1, 0x1));
+    EXPECT_EQ(OS_TASK_READY, Os_TaskControls[1].state) << "Woken task must resume, not restart";
+    EXPECT_TRUE(Os_DispatchPending) << "Woken task should preempt";
+    Run(1);
+    EXPECT_EQ(E_OK       , Os_GetEvent_Internal(1, &mask));
+    EXPECT_EQ(0x3        , mask);
+}
+
+TEST_F(Os_TestEvent, AlarmSetEvent1) {
+    m_alarms[0].action = OS_ALARM_ACTION_SETEVENT;
+    m_alarms[0].task   = 1;
+    m_alarms[0].event  = 0x4;
+
+    EXPECT_EQ(E_OK       , Os_ActivateTask_Internal(1));
+    Run(1);
+    EXPECT_EQ(E_OK       , Os_WaitEvent_Internal(0x4));
+    EXPECT_EQ(E_OK       , Os_Schedule_Internal());
+
+    EXPECT_EQ(E_OK       , Os_SetRelAlarm_Internal(0, 2, 0));
+    EXPECT_EQ(E_OK       , Os_IncrementCounter_Internal(OS_COUNTER_SYSTEM));
+    EXPECT_EQ(OS_TASK_WAITING, Os_TaskControls[1].state);
+    EXPECT_EQ(E_OK       , Os_IncrementCounter_Internal(OS_COUNTER_SYSTEM));
+    EXPECT_EQ(OS_TASK_READY  , Os_TaskControls[1].state) << "Alarm did not set event";
+    EXPECT_EQ(0x4        , Os_TaskControls[1].events);
+}
+
+
+TEST_F(Os_TestEvent, WaitEventTimeout1) {
+    Os_AlarmType timeout = (Os_AlarmType)(OS_ALARM_TIMEOUT_FIRST + 1);
+
+    EXPECT_EQ(E_OK       , Os_ActivateTask_Internal(1));
+    Run(1);
+    EXPECT_EQ(E_OS_VALUE , Os_WaitEventTimeout_Internal(0x1, 0)) << "Zero timeout";
+
+    /* an event already set neither waits nor arms the timeout */
+    EXPECT_EQ(E_OK       , Os_SetEvent_Internal(1, 0x1));
+    EXPECT_EQ(E_OK       , Os_WaitEventTimeout_Internal(0x1, 5));
+    EXPECT_EQ(OS_TASK_RUNNING, Os_TaskControls[1].state);
+    EXPECT_FALSE(Os_AlarmControls[timeout].queued);
+    EXPECT_EQ(E_OK       , Os_ClearEvent_Internal(0x1));
+
+    /* the timeout wakes the task */
+    EXPECT_EQ(E_OK       , Os_WaitEventTimeout_Internal(0x1, 3));
+    EXPECT_EQ(OS_TASK_WAITING, Os_TaskControls[1].state);
+    EXPECT_TRUE(Os_AlarmControls[timeout].queued);
+    EXPECT_EQ(E_OK       , Os_Schedule_Internal());
+    EXPECT_EQ(E_OK       , Os_AdvanceCounter_Internal(OS_COUNTER_SYSTEM, 2));
+    EXPECT_EQ(OS_TASK_WAITING, Os_TaskControls[1].state);
+    EXPECT_EQ(E_OK       , Os_IncrementCounter_Internal(OS_COUNTER_SYSTEM));
+    EXPECT_EQ(OS_TASK_READY  , Os_TaskControls[1].state) << "Timeout did not wake task";
+    EXPECT_TRUE(Os_TaskControls[1].timeout);
+    Run(1);
+
+    /* an event wakes the task and disarms the timeout */
+    EXPECT_EQ(E_OK       , Os_SetRelAlarm_Internal(0, 20, 0));
+    EXPECT_EQ(E_OK       , Os_WaitEventTimeout_Internal(0x2, 10));
+    EXPECT_EQ(E_OK       , Os_Schedule_Internal());
+    EXPECT_EQ(2          , Os_CounterControls[OS_COUNTER_SYSTEM].count);
+    EXPECT_EQ(E_OK       , Os_SetEvent_Internal(1, 0x2));
+    EXPECT_EQ(OS_TASK_READY  , Os_TaskControls[1].state);
+    EXPECT_FALSE(Os_TaskControls[1].timeout);
+    EXPECT_FALSE(Os_AlarmControls[timeout].queued) << "Timeout still armed";
+    EXPECT_EQ(1          , Os_CounterControls[OS_COUNTER_SYSTEM].count);
+    EXPECT_EQ(0          , Os_CounterControls[OS_COUNTER_SYSTEM].queue[0].alarm);
+    Run(1);
+
+    EXPECT_EQ(E_OK       , Os_AdvanceCounter_Internal(OS_COUNTER_SYSTEM, 15));
+    EXPECT_EQ(OS_TASK_RUNNING, Os_TaskControls[1].state) << "Disarmed timeout expired";
+}
+
+TEST_F(Os_TestEvent, SetEventGroup1) {
+    m_members[0] = 3;
+    m_members[1] = 1;
+    m_members[2] = 2;
+    m_groups[0].count = 3;
+    m_tasks[3].extended = TRUE;
+
+    EXPECT_EQ(E_OS_ID    , Os_SetEventGroup_Internal(OS_TASKGROUP_COUNT, 0x1)) << "Group of invalid ID";
+
+    EXPECT_EQ(E_OK       , Os_ActivateTask_Internal(2));
+    Run(2);
+    EXPECT_EQ(E_OK       , Os_WaitEvent_Internal(0x1));
+    EXPECT_EQ(E_OK       , Os_Schedule_Internal());
+    EXPECT_EQ(E_OK       , Os_ActivateTask_Internal(1));
+    Run(1);
+    EXPECT_EQ(E_OK       , Os_WaitEvent_Internal(0x3));
+    EXPECT_EQ(E_OK       , Os_ActivateTask_Internal(0));
+    Run(0);
+
+    /* members not waiting for the events only record them */
+    Os_DispatchPending = FALSE;
+    EXPECT_EQ(E_OK       , Os_SetEventGroup_Internal(0, 0x4));
+    EXPECT_EQ(OS_TASK_WAITING, Os_TaskControls[1].state);
+    EXPECT_EQ(OS_TASK_WAITING, Os_TaskControls[2].state);
+    EXPECT_EQ(0x4        , Os_TaskControls[1].events);
+    EXPECT_EQ(0x4        , Os_TaskControls[2].events);
+    EXPECT_FALSE(Os_DispatchPending);
+
+    /* all waiting members are woken, suspended ones are skipped */
+    EXPECT_EQ(E_OK       , Os_SetEventGroup_Internal(0, 0x1));
+    EXPECT_EQ(OS_TASK_SUSPENDED, Os_TaskControls[3].state);
+    EXPECT_EQ(0x0        , Os_TaskControls[3].events) << "Suspended member got events";
+    EXPECT_EQ(OS_TASK_READY, Os_TaskControls[1].state);
+    EXPECT_EQ(OS_TASK_READY, Os_TaskControls[2].state);
+    EXPECT_TRUE(Os_DispatchPending);
+
+    Run(2);
+    EXPECT_EQ(E_OK       , Os_TerminateTask_Internal());
+    Run(1);
+    EXPECT_EQ(0x5        , Os_TaskControls[1].events);
+}
+
+struct Os_TestIsr : public Os_TestInternal
+{
+    virtual void SetUp()
+    {
+        Os_TestInternal::SetUp();
+        for(Os_TaskType i = 0; i < OS_TASK_COUNT; ++i) {
+            m_tasks[i].activation = 1;
+        }
+        Os_Init(&m_config);
+        Os_ActiveTask  = 0;
+        Os_CallContext = OS_CONTEXT_TASK;
+    }
+};
+
+static uint8          Os_TestIsrNesting[OS_ISR_COUNT];
+static Os_ContextType Os_TestIsrContext[OS_ISR_COUNT];
+static Os_TaskType    Os_TestIsrActive;
+static Os_StatusType  Os_TestIsrSchedule;
+
+static Os_StatusType Os_TestIsrService(Os_ServiceIdType service, Os_TaskType task)
+{
+    Os_SyscallParamType param;
+    param.service = service;
+    param.p1.task = task;
+    return Os_Syscall_Internal(&param);
+}
+
+static void Os_TestIsr1(void)
+{
+    Os_TestIsrNesting[1] = Os_IsrNesting;
+    Os_TestIsrContext[1] = Os_CallContext;
+    Os_TestIsrSchedule   = Os_TestIsrService(OSServiceId_Schedule, 0);
+    EXPECT_EQ(E_OK, Os_TestIsrService(OSServiceId_ActivateTask, 2));
+}
+
+static void Os_TestIsr0(void)
+{
+    Os_TestIsrNesting[0] = Os_IsrNesting;
+    Os_TestIsrContext[0] = Os_CallContext;
+    EXPECT_EQ(E_OK, Os_TestIsrService(OSServiceId_ActivateTask, 3));
+    Os_Isr2(1);
+    Os_TestIsrActive = Os_ActiveTask;
+
+    /* left held on return */
+    EXPECT_EQ(E_OK, Os_GetResource_Internal(OS_RES_SCHEDULER));
+}
+
+TEST_F(Os_TestIsr, Nesting1) {
+    m_isrs[0].entry = Os_TestIsr0;
+    m_isrs[1].entry = Os_TestIsr1;
+
+    EXPECT_EQ(E_OK       , Os_ActivateTask_Internal(1));
+    EXPECT_EQ(E_OK       , Os_Schedule_Internal());
+    EXPECT_EQ(1          , Os_ActiveTask);
+
+    Os_Isr2(0);
+    EXPECT_EQ(1                , Os_TestIsrNesting[0]);
+    EXPECT_EQ(2                , Os_TestIsrNesting[1]);
+    EXPECT_EQ(OS_CONTEXT_ISR2  , Os_TestIsrContext[0]);
+    EXPECT_EQ(OS_CONTEXT_ISR2  , Os_TestIsrContext[1]);
+    EXPECT_EQ(E_OS_CALLEVEL    , Os_TestIsrSchedule) << "Rescheduled from interrupt";
+    EXPECT_EQ(1                , Os_TestIsrActive)   << "Switched before outermost interrupt exit";
+
+    ASSERT_FALSE(Os_Errors.empty());
+    EXPECT_EQ(E_OS_RESOURCE    , Os_Errors.top())    << "Resource held on return not reported";
+    EXPECT_EQ(OS_INVALID_RESOURCE, Os_TaskControls[1].resource);
+    EXPECT_EQ(1                , Os_TaskControls[1].priority);
+
+    EXPECT_EQ(0                , Os_IsrNesting);
+    EXPECT_EQ(OS_CONTEXT_TASK  , Os_CallContext);
+    EXPECT_EQ(3                , Os_ActiveTask);
+    EXPECT_EQ(OS_TASK_READY    , Os_TaskControls[1].state);
+    EXPECT_EQ(OS_TASK_READY_FIRST, Os_TaskControls[2].state);
+}
 
 struct Os_TestResource : public Os_TestInternal
 {
@@ -220,3 +1033,41 @@ TEST_F(Os_TestResource, GetResource1) {
 TEST_F(Os_TestResource, ReleaseResource1) {
     EXPECT_EQ(E_OS_ID    , Os_ReleaseResource_Internal(OS_RES_COUNT))   << "Resource of invalid ID";
 }
+
+struct Os_TestReady : public Os_TestInternal
+{
+    virtual void SetUp()
+    {
+        Os_TestInternal::SetUp();
+        Os_Init(&m_config);
+    }
+};
+
+TEST_F(Os_TestReady, Peek1) {
+    Os_TaskType task;
+    Os_TaskPeek(-1, &task);
+    EXPECT_EQ(OS_INVALID_TASK, task) << "No task should be ready";
+
+    EXPECT_EQ(-1, Os_TaskReadyHighest);
+
+    Os_ReadyListPushTail(1, 1);
+    Os_ReadyListPushTail(2, 2);
+    EXPECT_EQ(2, Os_TaskReadyHighest);
+    Os_TaskPeek(-1, &task);
+    EXPECT_EQ(2              , task);
+    Os_TaskPeek(2, &task);
+    EXPECT_EQ(OS_INVALID_TASK, task) << "Only tasks above minimum priority should be found";
+
+    Os_ReadyListPopHead(2, &task);
+    EXPECT_EQ(2              , task);
+    Os_TaskPeek(-1, &task);
+    EXPECT_EQ(1              , task) << "Ready mask not cleared on empty list";
+    EXPECT_EQ(1, Os_TaskReadyHighest);
+
+    Os_ReadyListPopHead(1, &task);
+    Os_ReadyListPopHead(1, &task);
+    EXPECT_EQ(OS_INVALID_TASK, task);
+    Os_TaskPeek(-1, &task);
+    EXPECT_EQ(OS_INVALID_TASK, task);
+    EXPECT_EQ(-1, Os_TaskReadyHighest);
+}